@@ -51,6 +51,10 @@
 #include <nmmintrin.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 using namespace clang;
 
 //===----------------------------------------------------------------------===//
@@ -2532,6 +2536,27 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
 
   char C;
   while (true) {
+#ifdef __SSE2__
+    // Skip 16 bytes at a time as long as none of them is non-ASCII, a null
+    // or a newline character.
+    const char *VecStart = CurPtr;
+    while (BufferEnd - CurPtr >= 16) {
+      __m128i Cv = _mm_loadu_si128((const __m128i *)CurPtr);
+      __m128i Special =
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Cv, _mm_set1_epi8('\n')),
+                                    _mm_cmpeq_epi8(Cv, _mm_set1_epi8('\r'))),
+                       _mm_cmpeq_epi8(Cv, _mm_setzero_si128()));
+      // The sign bits of Cv flag the non-ASCII bytes.
+      unsigned Mask = _mm_movemask_epi8(_mm_or_si128(Special, Cv));
+      if (Mask) {
+        CurPtr += llvm::countr_zero(Mask);
+        break;
+      }
+      CurPtr += 16;
+    }
+    if (CurPtr != VecStart)
+      UnicodeDecodingAlreadyDiagnosed = false;
+#endif
     C = *CurPtr;
     // Skip over characters in the fast loop.
     while (isASCII(C) && C != 0 &&   // Potentially EOF.
@@ -27,6 +27,7 @@
 #include "mlir/Pass/Pass.h"
 #include "mlir/Support/LLVM.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/TypeSwitch.h"
 #include <iterator>
 #include <memory>
@@ -40,6 +41,9 @@ namespace hlfir {
 
 #define DEBUG_TYPE "opt-bufferization"
 
+STATISTIC(NumElementalTempsAvoided,
+          "Number of hlfir.elemental temporaries replaced by an in-place loop");
+
 namespace {
 
 /// This transformation should match in place modification of arrays.
@@ -498,6 +502,7 @@ mlir::LogicalResult ElementalAssignBufferization::matchAndRewrite(
   rewriter.eraseOp(match->assign);
   rewriter.eraseOp(match->destroy);
   rewriter.eraseOp(elemental);
+  ++NumElementalTempsAvoided;
   return mlir::success();
 }
 
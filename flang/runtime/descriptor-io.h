@@ -424,12 +424,32 @@ static bool UnformattedDescriptorIO(IoStatementState &io,
                            : childUnf->Receive(&x, totalBytes, swappingBytes);
       }
     }};
-    bool swapEndianness{externalUnf && externalUnf->unit().swapEndianness()};
-    if (!swapEndianness &&
-        descriptor.IsContiguous()) { // contiguous unformatted I/O
+    // Byte swapping, when active, is applied by the unit to each
+    // swappingBytes-sized unit of a transfer, so it doesn't prevent
+    // block transfers.
+    if (descriptor.IsContiguous()) { // contiguous unformatted I/O
       char &x{ExtractElement<char>(io, descriptor, subscripts)};
       return Transfer(x, numElements * elementBytes);
-    } else { // non-contiguous or byte-swapped intrinsic type unformatted I/O
+    } else if (const Dimension & dim0{descriptor.GetDimension(0)};
+               dim0.ByteStride() ==
+               static_cast<SubscriptValue>(elementBytes)) {
+      // Non-contiguous, but with contiguous columns: transfer one column
+      // at a time.
+      SubscriptValue columnElements{dim0.Extent()};
+      std::size_t columnBytes{columnElements * elementBytes};
+      for (std::size_t j{0}; j < numElements; j += columnElements) {
+        char &x{ExtractElement<char>(io, descriptor, subscripts)};
+        if (!Transfer(x, columnBytes)) {
+          return false;
+        }
+        subscripts[0] = dim0.UpperBound();
+        if (!descriptor.IncrementSubscripts(subscripts) &&
+            j + columnElements < numElements) {
+          handler.Crash("DescriptorIO: subscripts out of bounds");
+        }
+      }
+      return true;
+    } else { // non-contiguous intrinsic type unformatted I/O
       for (std::size_t j{0}; j < numElements; ++j) {
         char &x{ExtractElement<char>(io, descriptor, subscripts)};
         if (!Transfer(x, elementBytes)) {
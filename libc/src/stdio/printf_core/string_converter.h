@@ -9,6 +9,7 @@
 #ifndef LLVM_LIBC_SRC_STDIO_PRINTF_CORE_STRING_CONVERTER_H
 #define LLVM_LIBC_SRC_STDIO_PRINTF_CORE_STRING_CONVERTER_H
 
+#include "src/__support/CPP/limits.h"
 #include "src/__support/CPP/string_view.h"
 #include "src/__support/common.h"
 #include "src/stdio/printf_core/converter_utils.h"
@@ -30,14 +31,15 @@ LIBC_INLINE int convert_string(Writer *writer, const FormatSection &to_conv) {
   }
 #endif // LIBC_COPT_PRINTF_NO_NULLPTR_CHECKS
 
-  for (const char *cur_str = (str_ptr); cur_str[string_len]; ++string_len) {
+  // If a precision is given, the string doesn't need to be null terminated and
+  // at most that many characters are read from it.
+  const size_t max_len = to_conv.precision >= 0
+                             ? static_cast<size_t>(to_conv.precision)
+                             : cpp::numeric_limits<size_t>::max();
+  for (; string_len < max_len && str_ptr[string_len]; ++string_len) {
     ;
   }
 
-  if (to_conv.precision >= 0 &&
-      static_cast<size_t>(to_conv.precision) < string_len)
-    string_len = to_conv.precision;
-
   size_t padding_spaces = to_conv.min_width > static_cast<int>(string_len)
                               ? to_conv.min_width - string_len
                               : 0;
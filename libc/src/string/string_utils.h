@@ -224,14 +224,48 @@ LIBC_INLINE size_t strlcpy(char *__restrict dst, const char *__restrict src,
   return len;
 }
 
+template <typename Word, bool ReturnNull>
+LIBC_INLINE char *strchr_wide_read(const char *src, char ch) {
+  const char *char_ptr = src;
+  // Step 1: read 1 byte at a time to align to block size
+  for (; reinterpret_cast<uintptr_t>(char_ptr) % sizeof(Word) != 0;
+       ++char_ptr) {
+    if (*char_ptr == ch)
+      return const_cast<char *>(char_ptr);
+    if (*char_ptr == '\0')
+      return ReturnNull ? nullptr : const_cast<char *>(char_ptr);
+  }
+
+  const Word ch_mask = repeat_byte<Word>(ch);
+
+  // Step 2: read blocks until one contains either the character or the null
+  // terminator
+  for (const Word *block_ptr = reinterpret_cast<const Word *>(char_ptr);
+       !has_zeroes<Word>(*block_ptr) && !has_zeroes<Word>(*block_ptr ^ ch_mask);
+       ++block_ptr) {
+    char_ptr = reinterpret_cast<const char *>(block_ptr + 1);
+  }
+
+  // Step 3: find the match in the block
+  for (; *char_ptr != ch && *char_ptr != '\0'; ++char_ptr)
+    ;
+  if (*char_ptr == ch)
+    return const_cast<char *>(char_ptr);
+  return ReturnNull ? nullptr : const_cast<char *>(char_ptr);
+}
+
 template <bool ReturnNull = true>
-LIBC_INLINE constexpr static char *strchr_implementation(const char *src,
-                                                         int c) {
+LIBC_INLINE static char *strchr_implementation(const char *src, int c) {
   char ch = static_cast<char>(c);
+#ifdef LIBC_COPT_STRING_UNSAFE_WIDE_READ
+  // Unsigned int is used for the same reason as in strlen.
+  return strchr_wide_read<unsigned int, ReturnNull>(src, ch);
+#else
   for (; *src && *src != ch; ++src)
     ;
   char *ret = ReturnNull ? nullptr : const_cast<char *>(src);
   return *src == ch ? const_cast<char *>(src) : ret;
+#endif
 }
 
 LIBC_INLINE constexpr static char *strrchr_implementation(const char *src,
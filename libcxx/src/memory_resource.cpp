@@ -6,6 +6,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <__bit/countl.h>
+#include <limits>
 #include <memory>
 #include <memory_resource>
 
@@ -279,15 +281,11 @@ int unsynchronized_pool_resource::__pool_index(size_t bytes, size_t align) const
   if (align > alignof(std::max_align_t) || bytes > (size_t(1) << __num_fixed_pools_))
     return __num_fixed_pools_;
   else {
-    int i = 0;
     bytes = (bytes > align) ? bytes : align;
     bytes -= 1;
     bytes >>= __log2_smallest_block_size;
-    while (bytes != 0) {
-      bytes >>= 1;
-      i += 1;
-    }
-    return i;
+    // The index is the number of significant bits left in bytes.
+    return bytes == 0 ? 0 : numeric_limits<size_t>::digits - std::__libcpp_clz(bytes);
   }
 }
 
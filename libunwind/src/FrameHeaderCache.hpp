@@ -37,7 +37,11 @@ class _LIBUNWIND_HIDDEN FrameHeaderCache {
     CacheEntry *Next;
   };
 
-  static const size_t kCacheEntryCount = 8;
+  // Programs that throw through many shared libraries cycle through more
+  // DSOs than a handful of entries can hold. A miss costs a walk over the
+  // remaining loaded objects, which is far more expensive than scanning a
+  // few more entries here.
+  static const size_t kCacheEntryCount = 16;
 
   // Can't depend on the C++ standard library in libunwind, so use an array to
   // allocate the entries, and two linked lists for ordering unused and recently
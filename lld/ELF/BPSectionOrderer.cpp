@@ -0,0 +1,149 @@
+//===- BPSectionOrderer.cpp -----------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+///
+/// This file implements --bp-compression-sort=, which reorders input sections
+/// with balanced partitioning to improve the compression ratio of the output.
+///
+/// Each section is represented by the set of hashes of the byte windows in its
+/// contents. Balanced partitioning then places sections sharing many hashes
+/// close to each other, which gives Lempel-Ziv style compressors shorter
+/// back-references and thus a smaller compressed binary.
+///
+//===----------------------------------------------------------------------===//
+
+#include "BPSectionOrderer.h"
+#include "Config.h"
+#include "InputFiles.h"
+#include "InputSection.h"
+#include "SyntheticSections.h"
+#include "lld/Common/ErrorHandler.h"
+#include "llvm/Support/BalancedPartitioning.h"
+#include "llvm/Support/Parallel.h"
+#include "llvm/Support/TimeProfiler.h"
+#include "llvm/Support/xxhash.h"
+
+using namespace llvm;
+using namespace llvm::ELF;
+using namespace lld;
+using namespace lld::elf;
+
+// The number of bytes hashed together to form one utility node. Short windows
+// catch more sharing between sections at the cost of more utility nodes.
+static constexpr size_t windowSize = 4;
+
+static SmallVector<uint64_t, 0> getContentHashes(const InputSection &sec) {
+  ArrayRef<uint8_t> data = sec.content();
+  SmallVector<uint64_t, 0> hashes;
+  if (data.size() < windowSize)
+    return hashes;
+  hashes.reserve(data.size() - windowSize + 1);
+  for (size_t i = 0; i + windowSize <= data.size(); ++i)
+    hashes.push_back(xxh3_64bits(data.slice(i, windowSize)));
+  llvm::sort(hashes);
+  hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+  return hashes;
+}
+
+// Returns true if the input order of sections with this name is meaningful,
+// either because the program relies on it or because their output section is
+// sorted specially (see sortSection in Writer.cpp). With a SECTIONS command
+// that special sorting is skipped, so reordering them here would not be undone.
+static bool isOrderSensitive(StringRef name) {
+  return name == ".init" || name == ".fini" || name == ".jcr" ||
+         name == ".toc" || name.starts_with(".ctors") ||
+         name.starts_with(".dtors") || name.starts_with(".init_array") ||
+         name.starts_with(".fini_array");
+}
+
+// Runs balanced partitioning over sections and returns them in the computed
+// order.
+static SmallVector<InputSection *, 0>
+partition(ArrayRef<InputSection *> sections) {
+  if (sections.size() < 2)
+    return SmallVector<InputSection *, 0>(sections);
+
+  SmallVector<SmallVector<uint64_t, 0>, 0> hashes(sections.size());
+  parallelFor(0, sections.size(), [&](size_t i) {
+    hashes[i] = getContentHashes(*sections[i]);
+  });
+
+  // A hash shared by a single section does not affect the objective, and a
+  // hash shared by (almost) all sections only adds work, so drop both. Give
+  // the remaining hashes dense utility node IDs.
+  DenseMap<uint64_t, uint32_t> frequency;
+  for (ArrayRef<uint64_t> v : hashes)
+    for (uint64_t h : v)
+      ++frequency[h];
+  const uint32_t maxFrequency = std::max<size_t>(sections.size() / 2, 2);
+  DenseMap<uint64_t, BPFunctionNode::UtilityNodeT> utilityNodes;
+  for (auto &[h, count] : frequency)
+    if (count >= 2 && count <= maxFrequency)
+      utilityNodes.try_emplace(h, utilityNodes.size());
+  frequency.clear();
+
+  std::vector<BPFunctionNode> nodes;
+  nodes.reserve(sections.size());
+  SmallVector<BPFunctionNode::UtilityNodeT, 0> uns;
+  for (size_t i = 0, e = sections.size(); i != e; ++i) {
+    // Take ownership of the hashes so that they are freed as we go.
+    SmallVector<uint64_t, 0> v = std::move(hashes[i]);
+    uns.clear();
+    for (uint64_t h : v) {
+      auto it = utilityNodes.find(h);
+      if (it != utilityNodes.end())
+        uns.push_back(it->second);
+    }
+    nodes.emplace_back(i, uns);
+  }
+
+  BalancedPartitioningConfig bpConfig;
+  BalancedPartitioning(bpConfig).run(nodes);
+
+  SmallVector<InputSection *, 0> ret;
+  ret.reserve(nodes.size());
+  for (const BPFunctionNode &n : nodes)
+    ret.push_back(sections[n.Id]);
+  return ret;
+}
+
+void elf::orderSectionsForCompression(
+    DenseMap<const InputSectionBase *, int> &sectionOrder) {
+  llvm::TimeTraceScope timeScope("Balanced partitioning for compression");
+
+  // Collect live sections from input files that have not been ordered by other
+  // means. Function and data sections are partitioned separately since they
+  // never share an output section.
+  SmallVector<InputSection *, 0> functions, data;
+  for (InputSectionBase *s : ctx.inputSections) {
+    auto *sec = dyn_cast<InputSection>(s);
+    if (!sec || isa<SyntheticSection>(sec) || !sec->file || !sec->isLive() ||
+        !(sec->flags & SHF_ALLOC) || sec->type != SHT_PROGBITS ||
+        sec->getSize() == 0 || sectionOrder.count(sec) ||
+        isOrderSensitive(sec->name))
+      continue;
+    if (sec->flags & SHF_EXECINSTR) {
+      if (config->bpFunctionOrderForCompression)
+        functions.push_back(sec);
+    } else if (config->bpDataOrderForCompression) {
+      data.push_back(sec);
+    }
+  }
+
+  // Sections ordered by --symbol-ordering-file have negative priorities, and
+  // those ordered by the call graph profile have priorities starting at 1.
+  // Place the reordered sections after all of them.
+  int priority = 1;
+  for (const auto &[sec, prio] : sectionOrder)
+    priority = std::max(priority, prio + 1);
+  for (ArrayRef<InputSection *> v : {ArrayRef(functions), ArrayRef(data)})
+    for (InputSection *sec : partition(v))
+      sectionOrder[sec] = priority++;
+
+  log("--bp-compression-sort: reordered " + Twine(functions.size()) +
+      " function and " + Twine(data.size()) + " data sections");
+}
@@ -0,0 +1,24 @@
+//===- BPSectionOrderer.h ---------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLD_ELF_BP_SECTION_ORDERER_H
+#define LLD_ELF_BP_SECTION_ORDERER_H
+
+#include "llvm/ADT/DenseMap.h"
+
+namespace lld::elf {
+class InputSectionBase;
+
+// Assigns priorities to the sections selected by --bp-compression-sort= so
+// that sections with similar contents end up next to each other. Sections
+// that already have a priority in sectionOrder are left untouched.
+void orderSectionsForCompression(
+    llvm::DenseMap<const InputSectionBase *, int> &sectionOrder);
+} // namespace lld::elf
+
+#endif
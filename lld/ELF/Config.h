@@ -218,6 +218,8 @@ struct Config {
   bool asNeeded = false;
   bool armBe8 = false;
   BsymbolicKind bsymbolic = BsymbolicKind::None;
+  bool bpFunctionOrderForCompression = false;
+  bool bpDataOrderForCompression = false;
   CGProfileSortKind callGraphProfileSort;
   bool checkSections;
   bool checkDynamicRelocs;
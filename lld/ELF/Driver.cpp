@@ -1240,6 +1240,15 @@ static void readConfigs(opt::InputArgList &args) {
     else if (arg->getOption().matches(OPT_Bsymbolic))
       config->bsymbolic = BsymbolicKind::All;
   }
+  if (auto *arg = args.getLastArg(OPT_bp_compression_sort)) {
+    StringRef s = arg->getValue();
+    if (s == "function" || s == "both")
+      config->bpFunctionOrderForCompression = true;
+    if (s == "data" || s == "both")
+      config->bpDataOrderForCompression = true;
+    if (s != "none" && s != "function" && s != "data" && s != "both")
+      error("unknown --bp-compression-sort= value: " + s);
+  }
   config->callGraphProfileSort = getCGProfileSortKind(args);
   config->checkSections =
       args.hasFlag(OPT_check_sections, OPT_no_check_sections, true);
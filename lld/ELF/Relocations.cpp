@@ -1425,8 +1425,12 @@ template <class ELFT, class RelTy> void RelocationScanner::scanOne(RelTy *&i) {
     // Record the TOC entry (.toc + addend) as not relaxable. See the comment in
     // InputSectionBase::relocateAlloc().
     if (type == R_PPC64_TOC16_LO && sym.isSection() && isa<Defined>(sym) &&
-        cast<Defined>(sym).section->name == ".toc")
+        cast<Defined>(sym).section->name == ".toc") {
+      // Sections are scanned in parallel. The set is only used for membership
+      // tests, so the insertion order does not affect the output.
+      std::lock_guard<std::mutex> lock(relocMutex);
       ppc64noTocRelax.insert({&sym, addend});
+    }
 
     if ((type == R_PPC64_TLSGD && expr == R_TLSDESC_CALL) ||
         (type == R_PPC64_TLSLD && expr == R_TLSLD_HINT)) {
@@ -1552,10 +1556,10 @@ template <class ELFT> void elf::scanRelocations() {
   // directly processed by InputSection::relocateNonAlloc.
 
   // Deterministic parallellism needs sorting relocations which is unsuitable
-  // for -z nocombreloc. MIPS and PPC64 use global states which are not suitable
-  // for parallelism.
-  bool serial = !config->zCombreloc || config->emachine == EM_MIPS ||
-                config->emachine == EM_PPC64;
+  // for -z nocombreloc. MIPS allocates GOT entries in scan order, which is
+  // not suitable for parallelism. PPC64 state updated during the scan is
+  // either per-file or order-independent.
+  bool serial = !config->zCombreloc || config->emachine == EM_MIPS;
   parallel::TaskGroup tg;
   for (ELFFileBase *f : ctx.objectFiles) {
     auto fn = [f]() {
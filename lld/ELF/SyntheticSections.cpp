@@ -2840,14 +2840,19 @@ createSymbols(
   for (ArrayRef<GdbSymbol> v : ArrayRef(symbols.get(), numShards))
     numSymbols += v.size();
 
+  // The uniquifying maps are no longer needed.
+  map.reset();
+
   // The return type is a flattened vector, so we'll copy each vector
-  // contents to Ret.
+  // contents to Ret. Each shard is freed as soon as it has been copied so
+  // that we don't keep two copies of all symbols alive at the same time.
   SmallVector<GdbSymbol, 0> ret;
   ret.reserve(numSymbols);
-  for (SmallVector<GdbSymbol, 0> &vec :
-       MutableArrayRef(symbols.get(), numShards))
-    for (GdbSymbol &sym : vec)
+  for (size_t shardId = 0; shardId != numShards; ++shardId) {
+    SmallVector<GdbSymbol, 0> shard = std::move(symbols[shardId]);
+    for (GdbSymbol &sym : shard)
       ret.push_back(std::move(sym));
+  }
 
   // CU vectors and symbol names are adjacent in the output file.
   // We can compute their offsets in the output file now.
@@ -815,7 +815,9 @@ public:
 
   struct GdbSymbol {
     llvm::CachedHashStringRef name;
-    SmallVector<uint32_t, 0> cuVector;
+    // Most names are defined by a single compilation unit, so keep one entry
+    // inline to avoid a heap allocation per symbol.
+    SmallVector<uint32_t, 1> cuVector;
     uint32_t nameOff;
     uint32_t cuVectorOff;
   };
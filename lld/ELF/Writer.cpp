@@ -9,6 +9,7 @@
 #include "Writer.h"
 #include "AArch64ErrataFix.h"
 #include "ARMErrataFix.h"
+#include "BPSectionOrderer.h"
 #include "CallGraphSort.h"
 #include "Config.h"
 #include "InputFiles.h"
@@ -646,6 +647,14 @@ template <class ELFT> void Writer<ELFT>::run() {
       writeSectionsBinary();
     }
 
+    // Input section contents have been copied to the output buffer, so the
+    // input file pages are no longer needed except for the occasional symbol
+    // name lookup. Mark them as MADV_DONTNEED so that they do not add to the
+    // peak memory usage while the build ID is computed and the output is
+    // committed.
+    for (MemoryBuffer &mb : llvm::make_pointee_range(ctx.memoryBuffers))
+      mb.dontNeedIfMmap();
+
     // Backfill .note.gnu.build-id section content. This is done at last
     // because the content is usually a hash value of the entire output file.
     writeBuildId();
@@ -1291,9 +1300,12 @@ static void maybeShuffle(DenseMap<const InputSectionBase *, int> &order) {
         sec = matched[i++];
   }
 
-  // Existing priorities are < 0, so use priorities >= 0 for the missing
-  // sections.
+  // Existing priorities come from --symbol-ordering-file (< 0), the call graph
+  // profile or --bp-compression-sort= (> 0). Use priorities greater than all of
+  // them for the missing sections so that the ranges don't interleave.
   int prio = 0;
+  for (const auto &[sec, p] : order)
+    prio = std::max(prio, p + 1);
   for (InputSectionBase *sec : sections) {
     if (order.try_emplace(sec, prio).second)
       ++prio;
@@ -1301,12 +1313,8 @@ static void maybeShuffle(DenseMap<const InputSectionBase *, int> &order) {
 }
 
 // Builds section order for handling --symbol-ordering-file.
-static DenseMap<const InputSectionBase *, int> buildSectionOrder() {
+static DenseMap<const InputSectionBase *, int> buildSymbolOrderingFileOrder() {
   DenseMap<const InputSectionBase *, int> sectionOrder;
-  // Use the rarely used option --call-graph-ordering-file to sort sections.
-  if (!config->callGraphProfile.empty())
-    return computeCallGraphProfileOrder();
-
   if (config->symbolOrderingFile.empty())
     return sectionOrder;
 
@@ -1358,6 +1366,23 @@ static DenseMap<const InputSectionBase *, int> buildSectionOrder() {
   return sectionOrder;
 }
 
+// Builds the section order used by sortInputSections().
+static DenseMap<const InputSectionBase *, int> buildSectionOrder() {
+  // A call graph profile, from --call-graph-ordering-file or from the
+  // .llvm.call-graph-profile sections of PGO-built objects, takes precedence
+  // over --symbol-ordering-file.
+  DenseMap<const InputSectionBase *, int> sectionOrder =
+      !config->callGraphProfile.empty() ? computeCallGraphProfileOrder()
+                                        : buildSymbolOrderingFileOrder();
+
+  // Sections left unordered by the above are ordered by --bp-compression-sort=
+  // and placed after the ordered ones.
+  if (config->bpFunctionOrderForCompression ||
+      config->bpDataOrderForCompression)
+    orderSectionsForCompression(sectionOrder);
+  return sectionOrder;
+}
+
 // Sorts the sections in ISD according to the provided section order.
 static void
 sortISDBySectionOrder(InputSectionDescription *isd,
@@ -1204,6 +1204,18 @@ static void createFiles(const InputArgList &args) {
   }
 }
 
+// Splitting a cstring section into pieces hashes every string in it, so we
+// do it for all input files in parallel instead of while parsing each file.
+static void splitCStringSections() {
+  TimeTraceScope timeScope("Split cstring sections");
+  parallelForEach(inputFiles, [](const InputFile *file) {
+    for (const Section *section : file->sections)
+      for (const Subsection &subsection : section->subsections)
+        if (auto *isec = dyn_cast<CStringInputSection>(subsection.isec))
+          isec->splitIntoPieces();
+  });
+}
+
 static void gatherInputSections() {
   TimeTraceScope timeScope("Gathering input sections");
   int inputOrder = 0;
@@ -1959,6 +1971,7 @@ bool link(ArrayRef<const char *> argsArr, llvm::raw_ostream &stdoutOS,
       inputFiles.insert(make<OpaqueFile>(MemoryBufferRef(), segName, sectName));
     }
 
+    splitCStringSections();
     gatherInputSections();
     if (config->callGraphProfileSort)
       priorityBuilder.extractCallGraphProfile();
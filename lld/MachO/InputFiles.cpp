@@ -378,10 +378,10 @@ void ObjFile::parseSections(ArrayRef<SectionHeader> sectionHeaders) {
               " contains relocations, which is unsupported");
       bool dedupLiterals =
           name == section_names::objcMethname || config->dedupStrings;
+      // The section is split into pieces later by splitCStringSections(),
+      // which processes all input files in parallel.
       InputSection *isec =
           make<CStringInputSection>(section, data, align, dedupLiterals);
-      // FIXME: parallelize this?
-      cast<CStringInputSection>(isec)->splitIntoPieces();
       section.subsections.push_back({0, isec});
     } else if (isWordLiteralSection(sec.flags)) {
       if (sec.nreloc)
@@ -221,8 +221,16 @@ void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
   parallelForEach(outputSections, [buf](OutputSection *s) {
     assert(s->isNeeded());
-    s->writeTo(buf);
+    if (!isa<CodeSection>(s) && !isa<DataSection>(s))
+      s->writeTo(buf);
   });
+
+  // Code and data sections consist of many independent chunks, which they
+  // write in parallel. Nested parallel loops run serially, so write these
+  // sections from this thread rather than as a task of the loop above.
+  for (OutputSection *s : outputSections)
+    if (isa<CodeSection>(s) || isa<DataSection>(s))
+      s->writeTo(buf);
 }
 
 // Computes a hash value of Data using a given hash function.
@@ -10,9 +10,11 @@
 #include "DynamicLoaderPOSIXDYLD.h"
 
 #include "lldb/Breakpoint/BreakpointLocation.h"
+#include "lldb/Core/Debugger.h"
 #include "lldb/Core/Module.h"
 #include "lldb/Core/ModuleSpec.h"
 #include "lldb/Core/PluginManager.h"
+#include "lldb/Core/Progress.h"
 #include "lldb/Core/Section.h"
 #include "lldb/Symbol/Function.h"
 #include "lldb/Symbol/ObjectFile.h"
@@ -24,6 +26,7 @@
 #include "lldb/Utility/LLDBLog.h"
 #include "lldb/Utility/Log.h"
 #include "lldb/Utility/ProcessInfo.h"
+#include "llvm/Support/ThreadPool.h"
 
 #include <memory>
 #include <optional>
@@ -640,6 +643,22 @@ void DynamicLoaderPOSIXDYLD::LoadAllCurrentModules() {
   m_process->PrefetchModuleSpecs(
       module_names, m_process->GetTarget().GetArchitecture().GetTriple());
 
+  if (m_process->GetTarget().GetParallelModuleLoad()) {
+    // Creating the modules and preloading their symbols is most of the work,
+    // and doesn't touch any state of the dynamic loader, so do it for all the
+    // modules concurrently. The loop below then finds them in the target's
+    // images and loads them at their addresses in order.
+    Progress progress("Loading shared libraries", module_names.size());
+    llvm::ThreadPoolTaskGroup task_group(Debugger::GetThreadPool());
+    for (const FileSpec &file_spec : module_names) {
+      task_group.async([this, &file_spec, &progress] {
+        FindModuleViaTarget(file_spec);
+        progress.Increment(1, file_spec.GetFilename().GetString());
+      });
+    }
+    task_group.wait();
+  }
+
   for (I = m_rendezvous.begin(), E = m_rendezvous.end(); I != E; ++I) {
     ModuleSP module_sp =
         LoadModuleAtAddress(I->file_spec, I->link_addr, I->base_addr, true);
@@ -10,6 +10,8 @@
 #include "DWARFDebugArangeSet.h"
 #include "DWARFUnit.h"
 #include "LogChannelDWARF.h"
+#include "lldb/Utility/DataEncoder.h"
+#include "lldb/Utility/DataExtractor.h"
 #include "lldb/Utility/Log.h"
 #include "lldb/Utility/Timer.h"
 
@@ -96,6 +98,48 @@ void DWARFDebugAranges::Sort(bool minimize) {
   m_aranges.CombineConsecutiveEntriesWithEqualData();
 }
 
+constexpr llvm::StringLiteral kIdentifierDWARFAranges("ARNG");
+constexpr uint32_t CURRENT_CACHE_VERSION = 1;
+
+void DWARFDebugAranges::Encode(DataEncoder &encoder) const {
+  encoder.AppendData(kIdentifierDWARFAranges);
+  encoder.AppendU32(CURRENT_CACHE_VERSION);
+  const size_t num_entries = m_aranges.GetSize();
+  encoder.AppendU32(num_entries);
+  for (size_t i = 0; i < num_entries; ++i) {
+    const RangeToDIE::Entry *entry = m_aranges.GetEntryAtIndex(i);
+    encoder.AppendU64(entry->GetRangeBase());
+    encoder.AppendU32(entry->GetByteSize());
+    encoder.AppendU32(entry->data);
+  }
+}
+
+bool DWARFDebugAranges::Decode(const DataExtractor &data,
+                               lldb::offset_t *offset_ptr) {
+  llvm::StringRef identifier((const char *)data.GetData(offset_ptr, 4), 4);
+  if (identifier != kIdentifierDWARFAranges)
+    return false;
+  const uint32_t version = data.GetU32(offset_ptr);
+  if (version != CURRENT_CACHE_VERSION)
+    return false;
+  const uint32_t num_entries = data.GetU32(offset_ptr);
+  // Each entry is 16 bytes, make sure the data isn't truncated so we never
+  // end up with a partially decoded table.
+  if (!data.ValidOffsetForDataOfSize(*offset_ptr, uint64_t(num_entries) * 16))
+    return false;
+  m_aranges.Clear();
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    const dw_addr_t base = data.GetU64(offset_ptr);
+    const uint32_t size = data.GetU32(offset_ptr);
+    const dw_offset_t cu_offset = data.GetU32(offset_ptr);
+    m_aranges.Append(RangeToDIE::Entry(base, size, cu_offset));
+  }
+  // The entries were saved sorted, this only recomputes the upper bounds used
+  // by the lookups.
+  m_aranges.Sort();
+  return true;
+}
+
 // FindAddress
 dw_offset_t DWARFDebugAranges::FindAddress(dw_addr_t address) const {
   const RangeToDIE::Entry *entry = m_aranges.FindEntryThatContains(address);
@@ -41,6 +41,16 @@ public:
   bool IsEmpty() const { return m_aranges.IsEmpty(); }
   size_t GetNumRanges() const { return m_aranges.GetSize(); }
 
+  /// Encode the sorted ranges into \a encoder so they can be saved in the
+  /// index cache.
+  void Encode(DataEncoder &encoder) const;
+
+  /// Decode ranges that were saved with Encode().
+  ///
+  /// \returns true if the ranges were decoded successfully, in which case
+  /// they are already sorted.
+  bool Decode(const DataExtractor &data, lldb::offset_t *offset_ptr);
+
   dw_offset_t OffsetAtIndex(uint32_t idx) const {
     const Range *range = m_aranges.GetEntryAtIndex(idx);
     if (range)
@@ -11,11 +11,16 @@
 #include <algorithm>
 #include <set>
 
+#include "lldb/Core/DataFileCache.h"
+#include "lldb/Core/Module.h"
 #include "lldb/Host/PosixApi.h"
 #include "lldb/Symbol/ObjectFile.h"
+#include "lldb/Utility/DataEncoder.h"
+#include "lldb/Utility/DataExtractor.h"
 #include "lldb/Utility/RegularExpression.h"
 #include "lldb/Utility/Stream.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/Format.h"
 
 #include "DWARFCompileUnit.h"
 #include "DWARFContext.h"
@@ -38,6 +43,9 @@ const DWARFDebugAranges &DWARFDebugInfo::GetCompileUnitAranges() {
     return *m_cu_aranges_up;
 
   m_cu_aranges_up = std::make_unique<DWARFDebugAranges>();
+  if (LoadArangesFromCache())
+    return *m_cu_aranges_up;
+
   const DWARFDataExtractor &debug_aranges_data =
       m_context.getOrLoadArangesData();
 
@@ -72,9 +80,66 @@ const DWARFDebugAranges &DWARFDebugInfo::GetCompileUnitAranges() {
 
   const bool minimize = true;
   m_cu_aranges_up->Sort(minimize);
+  SaveArangesToCache();
   return *m_cu_aranges_up;
 }
 
+std::string DWARFDebugInfo::GetArangesCacheKey() {
+  std::string key;
+  llvm::raw_string_ostream strm(key);
+  ObjectFile *objfile = m_dwarf.GetObjectFile();
+  strm << objfile->GetModule()->GetCacheKey() << "-dwarf-aranges-"
+       << llvm::format_hex(objfile->GetCacheHash(), 10);
+  return strm.str();
+}
+
+bool DWARFDebugInfo::LoadArangesFromCache() {
+  DataFileCache *cache = Module::GetIndexCache();
+  if (!cache)
+    return false;
+  ObjectFile *objfile = m_dwarf.GetObjectFile();
+  if (!objfile)
+    return false;
+  std::unique_ptr<llvm::MemoryBuffer> mem_buffer_up =
+      cache->GetCachedData(GetArangesCacheKey());
+  if (!mem_buffer_up)
+    return false;
+  DataExtractor data(mem_buffer_up->getBufferStart(),
+                     mem_buffer_up->getBufferSize(),
+                     endian::InlHostByteOrder(),
+                     objfile->GetAddressByteSize());
+  lldb::offset_t offset = 0;
+  CacheSignature signature;
+  if (!signature.Decode(data, &offset))
+    return false;
+  if (CacheSignature(objfile) != signature) {
+    cache->RemoveCacheFile(GetArangesCacheKey());
+    return false;
+  }
+  if (!m_cu_aranges_up->Decode(data, &offset)) {
+    m_cu_aranges_up->Clear();
+    return false;
+  }
+  return true;
+}
+
+void DWARFDebugInfo::SaveArangesToCache() {
+  DataFileCache *cache = Module::GetIndexCache();
+  if (!cache)
+    return; // Caching is not enabled.
+  ObjectFile *objfile = m_dwarf.GetObjectFile();
+  if (!objfile)
+    return;
+  DataEncoder file(endian::InlHostByteOrder(), objfile->GetAddressByteSize());
+  // The signature can't be encoded if the object file doesn't have anything
+  // to make a signature from.
+  CacheSignature signature(objfile);
+  if (!signature.Encode(file))
+    return;
+  m_cu_aranges_up->Encode(file);
+  cache->SetCachedData(GetArangesCacheKey(), file.GetData());
+}
+
 void DWARFDebugInfo::ParseUnitsFor(DIERef::Section section) {
   DWARFDataExtractor data = section == DIERef::Section::DebugTypes
                                 ? m_context.getOrLoadDebugTypesData()
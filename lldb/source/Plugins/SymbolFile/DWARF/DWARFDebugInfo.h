@@ -75,6 +75,14 @@ private:
 
   uint32_t FindUnitIndex(DIERef::Section section, dw_offset_t offset);
 
+  /// Cache the compile unit address ranges in the index cache, if it is
+  /// enabled, so they don't have to be rebuilt from the DIEs next time.
+  /// \{
+  std::string GetArangesCacheKey();
+  bool LoadArangesFromCache();
+  void SaveArangesToCache();
+  /// \}
+
   DWARFDebugInfo(const DWARFDebugInfo &) = delete;
   const DWARFDebugInfo &operator=(const DWARFDebugInfo &) = delete;
 };
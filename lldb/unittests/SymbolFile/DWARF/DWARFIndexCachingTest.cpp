@@ -8,6 +8,7 @@
 
 #include "Plugins/SymbolFile/DWARF/DIERef.h"
 #include "Plugins/SymbolFile/DWARF/DWARFDIE.h"
+#include "Plugins/SymbolFile/DWARF/DWARFDebugAranges.h"
 #include "Plugins/SymbolFile/DWARF/ManualDWARFIndex.h"
 #include "Plugins/SymbolFile/DWARF/NameToDIE.h"
 #include "TestingSupport/Symbol/YAMLModuleTester.h"
@@ -290,3 +291,44 @@ TEST(DWARFIndexCachingTest, CacheSignatureTests) {
   EXPECT_FALSE(sig.Decode(data, &data_offset));
 
 }
+
+static DWARFDebugAranges EncodeDecode(const DWARFDebugAranges &object,
+                                      ByteOrder byte_order) {
+  const uint8_t addr_size = 8;
+  DataEncoder encoder(byte_order, addr_size);
+  object.Encode(encoder);
+  llvm::ArrayRef<uint8_t> bytes = encoder.GetData();
+  DataExtractor data(bytes.data(), bytes.size(), byte_order, addr_size);
+  offset_t data_offset = 0;
+  DWARFDebugAranges decoded;
+  EXPECT_TRUE(decoded.Decode(data, &data_offset));
+  EXPECT_EQ(data_offset, bytes.size());
+  return decoded;
+}
+
+TEST(DWARFIndexCachingTest, DWARFDebugArangesEncodeDecode) {
+  // Tests DWARFDebugAranges::Encode(...) and DWARFDebugAranges::Decode(...)
+  DWARFDebugAranges aranges;
+  aranges.AppendRange(0x100, 0x1000, 0x2000);
+  aranges.AppendRange(0x200, 0x2000, 0x2100);
+  aranges.AppendRange(0x300, 0x100000000, 0x100000010);
+  aranges.Sort(/*minimize=*/true);
+
+  for (ByteOrder byte_order : {eByteOrderLittle, eByteOrderBig}) {
+    DWARFDebugAranges decoded = EncodeDecode(aranges, byte_order);
+    ASSERT_EQ(decoded.GetNumRanges(), aranges.GetNumRanges());
+    EXPECT_EQ(decoded.FindAddress(0x1000), 0x100u);
+    EXPECT_EQ(decoded.FindAddress(0x20ff), 0x200u);
+    EXPECT_EQ(decoded.FindAddress(0x100000008), 0x300u);
+    EXPECT_EQ(decoded.FindAddress(0x2100), DW_INVALID_OFFSET);
+  }
+
+  // Decoding data with a bad identifier must fail.
+  DataEncoder encoder(eByteOrderLittle, 8);
+  encoder.AppendData(llvm::StringRef("XXXX"));
+  llvm::ArrayRef<uint8_t> bytes = encoder.GetData();
+  DataExtractor data(bytes.data(), bytes.size(), eByteOrderLittle, 8);
+  offset_t data_offset = 0;
+  DWARFDebugAranges decoded;
+  EXPECT_FALSE(decoded.Decode(data, &data_offset));
+}
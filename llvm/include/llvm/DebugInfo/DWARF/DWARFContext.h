@@ -390,6 +390,9 @@ public:
   getLocalsForAddress(object::SectionedAddress Address) override;
 
   bool isLittleEndian() const { return DObj->isLittleEndian(); }
+
+  /// Whether this context was created to be used from multiple threads.
+  bool isThreadSafe() const { return State->isThreadSafe(); }
   static unsigned getMaxSupportedVersion() { return 5; }
   static bool isSupportedVersion(unsigned version) {
     return version >= 2 && version <= getMaxSupportedVersion();
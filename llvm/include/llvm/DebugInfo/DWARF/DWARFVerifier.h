@@ -85,7 +85,15 @@ private:
   bool IsObjectFile;
   bool IsMachOObject;
   using ReferenceMap = std::map<uint64_t, std::set<uint64_t>>;
-
+  /// The number of errors found in each verified section, for the summary.
+  std::map<StringRef, unsigned> ErrorCounts;
+  mutable unsigned NumWarnings = 0;
+
+  /// Adds \p NumErrors errors found in \p Section to the summary.
+  void addErrorCount(StringRef Section, unsigned NumErrors);
+  /// Returns the stream for error details, which is discarded when only a
+  /// summary of the errors was requested.
+  raw_ostream &detail() const;
   raw_ostream &error() const;
   raw_ostream &warn() const;
   raw_ostream &note() const;
@@ -348,6 +356,10 @@ public:
   bool verifyDebugStrOffsets(
       StringRef SectionName, const DWARFSection &Section, StringRef StrData,
       void (DWARFObject::*)(function_ref<void(const DWARFSection &)>) const);
+
+  /// Print the number of errors reported so far for each verified section,
+  /// and the number of warnings. Only prints anything if either was found.
+  void summarize();
 };
 
 static inline bool operator<(const DWARFVerifier::DieRangeInfo &LHS,
@@ -131,6 +131,13 @@ inline unsigned encodeULEB128(uint64_t Value, uint8_t *p,
 inline uint64_t decodeULEB128(const uint8_t *p, unsigned *n = nullptr,
                               const uint8_t *end = nullptr,
                               const char **error = nullptr) {
+  // Most encoded values (e.g. DWARF forms, abbreviation codes and small
+  // offsets) fit in a single byte.
+  if (LLVM_LIKELY(p != end && *p < 128)) {
+    if (n)
+      *n = 1;
+    return *p;
+  }
   const uint8_t *orig_p = p;
   uint64_t Value = 0;
   unsigned Shift = 0;
@@ -165,6 +172,12 @@ inline uint64_t decodeULEB128(const uint8_t *p, unsigned *n = nullptr,
 inline int64_t decodeSLEB128(const uint8_t *p, unsigned *n = nullptr,
                              const uint8_t *end = nullptr,
                              const char **error = nullptr) {
+  // Fast path for a single byte, sign extended from its bit 6.
+  if (LLVM_LIKELY(p != end && *p < 128)) {
+    if (n)
+      *n = 1;
+    return int64_t(uint64_t(*p) << 57) >> 57;
+  }
   const uint8_t *orig_p = p;
   int64_t Value = 0;
   unsigned Shift = 0;
@@ -154,6 +154,9 @@ public:
 /// are owned by the in-memory ModuleSummaryIndex the importing decisions
 /// are made from (the module path for each summary is owned by the index's
 /// module path string table).
+///
+/// \p isPrevailing may be called concurrently from several threads, so it
+/// must be thread-safe and free of side effects.
 void ComputeCrossModuleImport(
     const ModuleSummaryIndex &Index,
     const DenseMap<StringRef, GVSummaryMapTy> &ModuleToDefinedGVSummaries,
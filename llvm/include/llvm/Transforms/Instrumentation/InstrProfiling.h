@@ -73,6 +73,10 @@ private:
   // vector of counter load/store pairs to be register promoted.
   std::vector<LoadStorePair> PromotionCandidates;
 
+  // Counter updates to be made conditional for sampled instrumentation: the
+  // sampling check and the last instruction of the update that follows it.
+  std::vector<std::pair<Instruction *, Instruction *>> SampledIncrements;
+
   int64_t TotalCountersPromoted = 0;
 
   /// Lower instrumentation intrinsics in the function. Returns true if there
@@ -104,6 +108,14 @@ private:
   /// Replace instrprof.increment with an increment of the appropriate value.
   void lowerIncrement(InstrProfIncrementInst *Inc);
 
+  /// Get the per-thread variable that gates counter updates for sampled
+  /// instrumentation, creating it if necessary.
+  GlobalVariable *getOrCreateSamplingVar();
+
+  /// Move the counter updates in SampledIncrements under their sampling
+  /// checks.
+  void lowerSampledIncrements();
+
   /// Force emitting of name vars for unused functions.
   void lowerCoverageData(GlobalVariable *CoverageNamesVar);
 
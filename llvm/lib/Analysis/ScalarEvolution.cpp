@@ -142,6 +142,12 @@ STATISTIC(NumExitCountsNotComputed,
           "Number of loop exits without predictable exit counts");
 STATISTIC(NumBruteForceTripCountsComputed,
           "Number of loops with trip counts computed by force");
+STATISTIC(MaxUniqueSCEVs,
+          "Maximum number of unique SCEVs created for a single function");
+STATISTIC(MaxValueExprMapSize,
+          "Maximum number of cached Value to SCEV mappings for a function");
+STATISTIC(MaxSCEVAllocatorBytes,
+          "Maximum number of bytes allocated for SCEVs of a single function");
 
 #ifdef EXPENSIVE_CHECKS
 bool llvm::VerifySCEV = true;
@@ -13365,6 +13371,10 @@ ScalarEvolution::ScalarEvolution(ScalarEvolution &&Arg)
 }
 
 ScalarEvolution::~ScalarEvolution() {
+  MaxUniqueSCEVs.updateMax(UniqueSCEVs.size());
+  MaxValueExprMapSize.updateMax(ValueExprMap.size());
+  MaxSCEVAllocatorBytes.updateMax(SCEVAllocator.getTotalMemory());
+
   // Iterate through all the SCEVUnknown instances and call their
   // destructors, so that they release their references to their values.
   for (SCEVUnknown *U = FirstUnknown; U;) {
@@ -107,6 +107,7 @@ using namespace llvm::PatternMatch;
 
 #define DEBUG_TYPE "codegenprepare"
 
+STATISTIC(NumIterations, "Number of iterations over the function");
 STATISTIC(NumBlocksElim, "Number of blocks eliminated");
 STATISTIC(NumPHIsElim, "Number of trivial PHIs eliminated");
 STATISTIC(NumGEPsElim, "Number of GEPs converted to casts");
@@ -599,6 +600,7 @@ bool CodeGenPrepare::runOnFunction(Function &F) {
   bool FuncIterated = false;
   while (MadeChange) {
     MadeChange = false;
+    ++NumIterations;
 
     for (BasicBlock &BB : llvm::make_early_inc_range(F)) {
       if (FuncIterated && !FreshBBs.contains(&BB))
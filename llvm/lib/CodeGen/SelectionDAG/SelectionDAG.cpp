@@ -1357,8 +1357,17 @@ bool SelectionDAG::shouldOptForSize() const {
 void SelectionDAG::allnodes_clear() {
   assert(&*AllNodes.begin() == &EntryNode);
   AllNodes.remove(AllNodes.begin());
-  while (!AllNodes.empty())
-    DeallocateNode(&AllNodes.front());
+  // The callers drop all operand lists, debug values and extra info right
+  // after this, so hand the nodes back to the allocator directly instead of
+  // going through DeallocateNode, which unregisters each node from those one
+  // by one. This matters for functions with many basic blocks, where the DAG
+  // is cleared after every block.
+  while (!AllNodes.empty()) {
+    SDNode *N = AllNodes.remove(AllNodes.begin());
+    NodeAllocator.Deallocate(N);
+    __asan_unpoison_memory_region(&N->NodeType, sizeof(N->NodeType));
+    N->NodeType = ISD::DELETED_NODE;
+  }
 #ifndef NDEBUG
   NextPersistentId = 0;
 #endif
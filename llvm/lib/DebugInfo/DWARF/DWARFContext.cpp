@@ -1404,6 +1404,8 @@ bool DWARFContext::verify(raw_ostream &OS, DIDumpOptions DumpOpts) {
   if (DumpOpts.DumpType & DIDT_DebugStrOffsets)
     Success &= verifier.handleDebugStrOffsets();
   Success &= verifier.handleAccelTables();
+  if (DumpOpts.ShowAggregateErrors)
+    verifier.summarize();
   return Success;
 }
 
@@ -473,6 +473,21 @@ void DWARFUnit::extractDIEsIfNeeded(bool CUDieOnly) {
 }
 
 Error DWARFUnit::tryExtractDIEsIfNeeded(bool CUDieOnly) {
+  if (!Context.isThreadSafe())
+    return tryExtractDIEsIfNeededImpl(CUDieOnly);
+  if (DieArrayExtracted.load(std::memory_order_acquire))
+    return Error::success();
+  // Other threads may hold DIEs of this unit, which point into DieArray.
+  // Extracting only the unit DIE first and the rest later would reallocate
+  // the array under them, so always extract all DIEs at once.
+  std::lock_guard<std::mutex> Lock(DieArrayMutex);
+  Error E = tryExtractDIEsIfNeededImpl(/*CUDieOnly=*/false);
+  if (!DieArray.empty())
+    DieArrayExtracted.store(true, std::memory_order_release);
+  return E;
+}
+
+Error DWARFUnit::tryExtractDIEsIfNeededImpl(bool CUDieOnly) {
   if ((CUDieOnly && !DieArray.empty()) ||
       DieArray.size() > 1)
     return Error::success(); // Already parsed.
@@ -630,6 +645,14 @@ bool DWARFUnit::parseDWO(StringRef DWOAlternativeLocation) {
 }
 
 void DWARFUnit::clearDIEs(bool KeepCUDie) {
+  std::unique_lock<std::mutex> Lock(DieArrayMutex, std::defer_lock);
+  if (Context.isThreadSafe()) {
+    // Keeping only the unit DIE would make the next extraction append to
+    // DieArray, reallocating it under any other thread holding the unit DIE.
+    assert(!KeepCUDie && "cannot keep the unit DIE in a thread safe context");
+    Lock.lock();
+    DieArrayExtracted.store(false, std::memory_order_release);
+  }
   // Do not use resize() + shrink_to_fit() to free memory occupied by dies.
   // shrink_to_fit() is a *non-binding* request to reduce capacity() to size().
   // It depends on the implementation whether the request is fulfilled.
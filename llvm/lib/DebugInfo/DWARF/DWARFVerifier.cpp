@@ -230,7 +230,7 @@ unsigned DWARFVerifier::verifyUnitContents(DWARFUnit &Unit,
           Die.getFirstChild().getTag() == DW_TAG_null) {
         warn() << dwarf::TagString(Die.getTag())
                << " has DW_CHILDREN_yes but DIE has no children: ";
-        Die.dump(OS);
+        Die.dump(detail());
       }
     }
 
@@ -280,14 +280,14 @@ unsigned DWARFVerifier::verifyDebugInfoCallSite(const DWARFDie &Die) {
   for (; Curr.isValid() && !Curr.isSubprogramDIE(); Curr = Die.getParent()) {
     if (Curr.getTag() == DW_TAG_inlined_subroutine) {
       error() << "Call site entry nested within inlined subroutine:";
-      Curr.dump(OS);
+      Curr.dump(detail());
       return 1;
     }
   }
 
   if (!Curr.isValid()) {
     error() << "Call site entry not nested within a valid subprogram:";
-    Die.dump(OS);
+    Die.dump(detail());
     return 1;
   }
 
@@ -297,8 +297,8 @@ unsigned DWARFVerifier::verifyDebugInfoCallSite(const DWARFDie &Die) {
        DW_AT_GNU_all_source_call_sites, DW_AT_GNU_all_tail_call_sites});
   if (!CallAttr) {
     error() << "Subprogram with call site entry has no DW_AT_call attribute:";
-    Curr.dump(OS);
-    Die.dump(OS, /*indent*/ 1);
+    Curr.dump(detail());
+    Die.dump(detail(), /*indent*/ 1);
     return 1;
   }
 
@@ -325,7 +325,7 @@ unsigned DWARFVerifier::verifyAbbrevSection(const DWARFDebugAbbrev *Abbrev) {
       if (!Result.second) {
         error() << "Abbreviation declaration contains multiple "
                 << AttributeString(Attribute.Attr) << " attributes.\n";
-        AbbrDecl.dump(OS);
+        AbbrDecl.dump(detail());
         ++NumErrors;
       }
     }
@@ -343,6 +343,7 @@ bool DWARFVerifier::handleDebugAbbrev() {
   if (!DObj.getAbbrevDWOSection().empty())
     NumErrors += verifyAbbrevSection(DCtx.getDebugAbbrevDWO());
 
+  addErrorCount(".debug_abbrev", NumErrors);
   return NumErrors == 0;
 }
 
@@ -453,13 +454,19 @@ unsigned DWARFVerifier::verifyIndex(StringRef Name,
 }
 
 bool DWARFVerifier::handleDebugCUIndex() {
-  return verifyIndex(".debug_cu_index", DWARFSectionKind::DW_SECT_INFO,
-                     DCtx.getDWARFObj().getCUIndexSection()) == 0;
+  unsigned NumErrors =
+      verifyIndex(".debug_cu_index", DWARFSectionKind::DW_SECT_INFO,
+                  DCtx.getDWARFObj().getCUIndexSection());
+  addErrorCount(".debug_cu_index", NumErrors);
+  return NumErrors == 0;
 }
 
 bool DWARFVerifier::handleDebugTUIndex() {
-  return verifyIndex(".debug_tu_index", DWARFSectionKind::DW_SECT_EXT_TYPES,
-                     DCtx.getDWARFObj().getTUIndexSection()) == 0;
+  unsigned NumErrors =
+      verifyIndex(".debug_tu_index", DWARFSectionKind::DW_SECT_EXT_TYPES,
+                  DCtx.getDWARFObj().getTUIndexSection());
+  addErrorCount(".debug_tu_index", NumErrors);
+  return NumErrors == 0;
 }
 
 bool DWARFVerifier::handleDebugInfo() {
@@ -481,6 +488,7 @@ bool DWARFVerifier::handleDebugInfo() {
 
   OS << "Verifying dwo Units...\n";
   NumErrors += verifyUnits(DCtx.getDWOUnitsVector());
+  addErrorCount(".debug_info", NumErrors);
   return NumErrors == 0;
 }
 
@@ -757,7 +765,7 @@ unsigned DWARFVerifier::verifyDebugInfoForm(const DWARFDie &Die,
                 << format("0x%08" PRIx64, CUOffset)
                 << " is invalid (must be less than CU size of "
                 << format("0x%08" PRIx64, CUSize) << "):\n";
-        Die.dump(OS, 0, DumpOpts);
+        Die.dump(detail(), 0, DumpOpts);
         dump(Die) << '\n';
       } else {
         // Valid reference, but we will verify it points to an actual
@@ -824,7 +832,7 @@ unsigned DWARFVerifier::verifyDebugInfoReferences(
             << ". Offset is in between DIEs:\n";
     for (auto Offset : Pair.second)
       dump(GetDIEForOffset(Offset)) << '\n';
-    OS << "\n";
+    detail() << "\n";
   }
   return NumErrors;
 }
@@ -933,11 +941,11 @@ void DWARFVerifier::verifyDebugLineRows() {
                 << "] row[" << RowIndex
                 << "] decreases in address from previous row:\n";
 
-        DWARFDebugLine::Row::dumpTableHeader(OS, 0);
+        DWARFDebugLine::Row::dumpTableHeader(detail(), 0);
         if (RowIndex > 0)
-          LineTable->Rows[RowIndex - 1].dump(OS);
-        Row.dump(OS);
-        OS << '\n';
+          LineTable->Rows[RowIndex - 1].dump(detail());
+        Row.dump(detail());
+        detail() << '\n';
       }
 
       // Verify file index.
@@ -950,9 +958,9 @@ void DWARFVerifier::verifyDebugLineRows() {
                 << " (valid values are [" << MinFileIndex << ','
                 << LineTable->Prologue.FileNames.size()
                 << (isDWARF5 ? ")" : "]") << "):\n";
-        DWARFDebugLine::Row::dumpTableHeader(OS, 0);
-        Row.dump(OS);
-        OS << '\n';
+        DWARFDebugLine::Row::dumpTableHeader(detail(), 0);
+        Row.dump(detail());
+        detail() << '\n';
       }
       if (Row.EndSequence)
         PrevAddress = 0;
@@ -978,6 +986,7 @@ bool DWARFVerifier::handleDebugLine() {
   OS << "Verifying .debug_line...\n";
   verifyDebugLineStmtOffsets();
   verifyDebugLineRows();
+  addErrorCount(".debug_line", NumDebugLineErrors);
   return NumDebugLineErrors == 0;
 }
 
@@ -1672,6 +1681,7 @@ bool DWARFVerifier::handleAccelTables() {
 
   if (!D.getNamesSection().Data.empty())
     NumErrors += verifyDebugNames(D.getNamesSection(), StrData);
+  addErrorCount("accelerator tables", NumErrors);
   return NumErrors == 0;
 }
 
@@ -1708,7 +1718,7 @@ bool DWARFVerifier::verifyDebugStrOffsets(
 
   DataExtractor::Cursor C(0);
   uint64_t NextUnit = 0;
-  bool Success = true;
+  unsigned NumErrors = 0;
   while (C.seek(NextUnit), C.tell() < DA.getData().size()) {
     DwarfFormat Format;
     uint64_t Length;
@@ -1729,7 +1739,7 @@ bool DWARFVerifier::verifyDebugStrOffsets(
             "{4:X} > section size {5:X})\n",
             SectionName, StartOffset, C.tell() - StartOffset, Length,
             C.tell() + Length, DA.getData().size());
-        Success = false;
+        ++NumErrors;
         // Nothing more to do - no other contributions to try.
         break;
       }
@@ -1738,7 +1748,7 @@ bool DWARFVerifier::verifyDebugStrOffsets(
       if (C && Version != 5) {
         error() << formatv("{0}: contribution {1:X}: invalid version {2}\n",
                            SectionName, StartOffset, Version);
-        Success = false;
+        ++NumErrors;
         // Can't parse the rest of this contribution, since we don't know the
         // version, but we can pick up with the next contribution.
         continue;
@@ -1753,7 +1763,7 @@ bool DWARFVerifier::verifyDebugStrOffsets(
           "{0}: contribution {1:X}: invalid length ((length ({2:X}) "
           "- header (0x4)) % offset size {3:X} == {4:X} != 0)\n",
           SectionName, StartOffset, Length, OffsetByteSize, Remainder);
-      Success = false;
+      ++NumErrors;
     }
     for (uint64_t Index = 0; C && C.tell() + OffsetByteSize <= NextUnit; ++Index) {
       uint64_t OffOff = C.tell();
@@ -1766,6 +1776,7 @@ bool DWARFVerifier::verifyDebugStrOffsets(
             "{0}: contribution {1:X}: index {2:X}: invalid string "
             "offset *{3:X} == {4:X}, is beyond the bounds of the string section of length {5:X}\n",
             SectionName, StartOffset, Index, OffOff, StrOff, StrData.size());
+        ++NumErrors;
         continue;
       }
       if (StrData[StrOff - 1] == '\0')
@@ -1774,24 +1785,48 @@ bool DWARFVerifier::verifyDebugStrOffsets(
                          "offset *{3:X} == {4:X}, is neither zero nor "
                          "immediately following a null character\n",
                          SectionName, StartOffset, Index, OffOff, StrOff);
-      Success = false;
+      ++NumErrors;
     }
   }
 
   if (Error E = C.takeError()) {
     error() << SectionName << ": " << toString(std::move(E)) << '\n';
-    return false;
+    ++NumErrors;
   }
-  return Success;
+  addErrorCount(SectionName, NumErrors);
+  return NumErrors == 0;
+}
+
+void DWARFVerifier::addErrorCount(StringRef Section, unsigned NumErrors) {
+  if (NumErrors)
+    ErrorCounts[Section] += NumErrors;
+}
+
+void DWARFVerifier::summarize() {
+  if (!ErrorCounts.empty()) {
+    OS << "Summary of errors by section:\n";
+    for (const auto &[Section, Count] : ErrorCounts)
+      OS << format("%8u", Count) << ' ' << Section << '\n';
+  }
+  if (NumWarnings)
+    OS << "Found " << NumWarnings << " warning"
+       << (NumWarnings == 1 ? "" : "s") << ".\n";
 }
 
-raw_ostream &DWARFVerifier::error() const { return WithColor::error(OS); }
+raw_ostream &DWARFVerifier::detail() const {
+  return DumpOpts.ShowAggregateErrors ? nulls() : OS;
+}
 
-raw_ostream &DWARFVerifier::warn() const { return WithColor::warning(OS); }
+raw_ostream &DWARFVerifier::error() const { return WithColor::error(detail()); }
+
+raw_ostream &DWARFVerifier::warn() const {
+  ++NumWarnings;
+  return WithColor::warning(detail());
+}
 
-raw_ostream &DWARFVerifier::note() const { return WithColor::note(OS); }
+raw_ostream &DWARFVerifier::note() const { return WithColor::note(detail()); }
 
 raw_ostream &DWARFVerifier::dump(const DWARFDie &Die, unsigned indent) const {
-  Die.dump(OS, indent, DumpOpts);
-  return OS;
+  Die.dump(detail(), indent, DumpOpts);
+  return detail();
 }
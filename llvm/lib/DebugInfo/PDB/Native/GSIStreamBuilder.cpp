@@ -185,13 +185,17 @@ void GSIStreamBuilder::finalizeGlobalBuckets(uint32_t RecordZeroOffset) {
   Records.resize(Globals.size());
   uint32_t SymOffset = RecordZeroOffset;
   for (size_t I = 0, E = Globals.size(); I < E; ++I) {
-    StringRef Name = getSymbolName(Globals[I]);
-    Records[I].Name = Name.data();
-    Records[I].NameLen = Name.size();
     Records[I].SymOffset = SymOffset;
     SymOffset += Globals[I].length();
   }
 
+  // Extracting the name requires decoding each record, so do it in parallel.
+  parallelFor(0, Globals.size(), [&](size_t I) {
+    StringRef Name = getSymbolName(Globals[I]);
+    Records[I].Name = Name.data();
+    Records[I].NameLen = Name.size();
+  });
+
   GSH->finalizeBuckets(RecordZeroOffset, Records);
 }
 
@@ -379,17 +383,19 @@ void GSIStreamBuilder::addGlobalSymbol(const codeview::CVSymbol &Symbol) {
   Globals.push_back(Symbol);
 }
 
-// Serialize each public and write it.
+// Serialize each public and write it. The record offsets were assigned in
+// addPublicSymbols, so the records can be serialized in parallel into a single
+// buffer that is written at once.
 static Error writePublics(BinaryStreamWriter &Writer,
                           ArrayRef<BulkPublic> Publics) {
-  std::vector<uint8_t> Storage;
-  for (const BulkPublic &Pub : Publics) {
-    Storage.resize(sizeOfPublic(Pub));
-    serializePublic(Storage.data(), Pub);
-    if (Error E = Writer.writeBytes(Storage))
-      return E;
-  }
-  return Error::success();
+  if (Publics.empty())
+    return Error::success();
+  std::vector<uint8_t> Storage(Publics.back().SymOffset +
+                               sizeOfPublic(Publics.back()));
+  parallelFor(0, Publics.size(), [&](size_t I) {
+    serializePublic(Storage.data() + Publics[I].SymOffset, Publics[I]);
+  });
+  return Writer.writeBytes(Storage);
 }
 
 static Error writeRecords(BinaryStreamWriter &Writer,
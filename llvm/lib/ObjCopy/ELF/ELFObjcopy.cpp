@@ -31,6 +31,7 @@
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Memory.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
@@ -522,11 +523,29 @@ static Error replaceAndRemoveSections(const CommonConfig &Config,
     return E;
 
   if (Config.CompressionType != DebugCompressionType::None) {
+    // Compressing large debug sections dominates the run time, so compress
+    // them in parallel before creating the new sections, which has to happen
+    // sequentially.
+    SmallVector<const SectionBase *> ToCompress;
+    for (const SectionBase &Sec : Obj.sections())
+      if (isCompressable(Sec))
+        ToCompress.push_back(&Sec);
+    std::vector<SmallVector<uint8_t, 128>> CompressedData(ToCompress.size());
+    parallelFor(0, ToCompress.size(), [&](size_t I) {
+      compression::compress(compression::Params(Config.CompressionType),
+                            ToCompress[I]->OriginalData, CompressedData[I]);
+    });
+
+    // replaceDebugSections visits the same sections in the same order.
+    size_t Next = 0;
     if (Error Err = replaceDebugSections(
             Obj, isCompressable,
-            [&Config, &Obj](const SectionBase *S) -> Expected<SectionBase *> {
-              return &Obj.addSection<CompressedSection>(
-                  CompressedSection(*S, Config.CompressionType, Obj.Is64Bits));
+            [&](const SectionBase *S) -> Expected<SectionBase *> {
+              assert(Next < ToCompress.size() && ToCompress[Next] == S &&
+                     "sections to compress changed");
+              return &Obj.addSection<CompressedSection>(CompressedSection(
+                  *S, Config.CompressionType, Obj.Is64Bits,
+                  std::move(CompressedData[Next++])));
             }))
       return Err;
   } else if (Config.DecompressDebugSections) {
@@ -538,14 +538,26 @@ Error ELFSectionWriter<ELFT>::visit(const CompressedSection &Sec) {
   return Error::success();
 }
 
+static SmallVector<uint8_t, 128> compressData(ArrayRef<uint8_t> Data,
+                                              DebugCompressionType Type) {
+  SmallVector<uint8_t, 128> CompressedData;
+  compression::compress(compression::Params(Type), Data, CompressedData);
+  return CompressedData;
+}
+
 CompressedSection::CompressedSection(const SectionBase &Sec,
                                      DebugCompressionType CompressionType,
                                      bool Is64Bits)
-    : SectionBase(Sec), CompressionType(CompressionType),
-      DecompressedSize(Sec.OriginalData.size()), DecompressedAlign(Sec.Align) {
-  compression::compress(compression::Params(CompressionType), OriginalData,
-                        CompressedData);
+    : CompressedSection(Sec, CompressionType, Is64Bits,
+                        compressData(Sec.OriginalData, CompressionType)) {}
 
+CompressedSection::CompressedSection(const SectionBase &Sec,
+                                     DebugCompressionType CompressionType,
+                                     bool Is64Bits,
+                                     SmallVector<uint8_t, 128> &&CompressedData)
+    : SectionBase(Sec), CompressionType(CompressionType),
+      DecompressedSize(Sec.OriginalData.size()), DecompressedAlign(Sec.Align),
+      CompressedData(std::move(CompressedData)) {
   Flags |= ELF::SHF_COMPRESSED;
   size_t ChdrSize = Is64Bits ? sizeof(object::Elf_Chdr_Impl<object::ELF64LE>)
                              : sizeof(object::Elf_Chdr_Impl<object::ELF32LE>);
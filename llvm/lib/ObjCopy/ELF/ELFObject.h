@@ -549,6 +549,11 @@ class CompressedSection : public SectionBase {
 public:
   CompressedSection(const SectionBase &Sec,
     DebugCompressionType CompressionType, bool Is64Bits);
+  // Create a compressed section whose contents have already been compressed
+  // into CompressedData using CompressionType.
+  CompressedSection(const SectionBase &Sec,
+                    DebugCompressionType CompressionType, bool Is64Bits,
+                    SmallVector<uint8_t, 128> &&CompressedData);
   CompressedSection(ArrayRef<uint8_t> CompressedData, uint32_t ChType,
                     uint64_t DecompressedSize, uint64_t DecompressedAlign);
 
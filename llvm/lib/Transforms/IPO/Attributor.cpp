@@ -58,6 +58,7 @@
 #endif
 
 #include <cassert>
+#include <chrono>
 #include <optional>
 #include <string>
 
@@ -95,6 +96,12 @@ static cl::opt<unsigned>
                           cl::desc("Maximal number of fixpoint iterations."),
                           cl::init(32));
 
+static cl::opt<unsigned> MaxFixpointTimeMs(
+    "attributor-max-fixpoint-time-ms", cl::Hidden,
+    cl::desc("Stop the fixpoint iteration after this many milliseconds; "
+             "attributes not settled by then are given up (0 = no limit)."),
+    cl::init(0));
+
 static cl::opt<unsigned>
     MaxSpecializationPerCB("attributor-max-specializations-per-call-base",
                            cl::Hidden,
@@ -2129,6 +2136,16 @@ void Attributor::runTillFixpoint() {
   unsigned MaxIterations =
       Configuration.MaxFixpointIterations.value_or(SetFixpointIterations);
 
+  // Optional wall clock budget for the iteration. Stopping early is handled
+  // like reaching the iteration limit.
+  auto StartTime = std::chrono::steady_clock::now();
+  auto ExceededTimeBudget = [&]() {
+    return MaxFixpointTimeMs &&
+           std::chrono::steady_clock::now() - StartTime >=
+               std::chrono::milliseconds(MaxFixpointTimeMs);
+  };
+  bool TimedOut = false;
+
   SmallVector<AbstractAttribute *, 32> ChangedAAs;
   SetVector<AbstractAttribute *> Worklist, InvalidAAs;
   Worklist.insert(DG.SyntheticRoot.begin(), DG.SyntheticRoot.end());
@@ -2213,6 +2230,10 @@ void Attributor::runTillFixpoint() {
                     QueryAAsAwaitingUpdate.end());
     QueryAAsAwaitingUpdate.clear();
 
+    if (!Worklist.empty() && ExceededTimeBudget()) {
+      TimedOut = true;
+      break;
+    }
   } while (!Worklist.empty() && (IterationCounter++ < MaxIterations));
 
   if (IterationCounter > MaxIterations && !Functions.empty()) {
@@ -2224,6 +2245,17 @@ void Attributor::runTillFixpoint() {
     emitRemark<OptimizationRemarkMissed>(F, "FixedPoint", Remark);
   }
 
+  if (TimedOut && !Functions.empty()) {
+    auto Remark = [&](OptimizationRemarkMissed ORM) {
+      return ORM << "Attributor did not reach a fixpoint within "
+                 << ore::NV("TimeLimit", MaxFixpointTimeMs.getValue())
+                 << " ms, stopped after "
+                 << ore::NV("Iterations", IterationCounter) << " iterations.";
+    };
+    Function *F = Functions.front();
+    emitRemark<OptimizationRemarkMissed>(F, "FixedPointTimeout", Remark);
+  }
+
   LLVM_DEBUG(dbgs() << "\n[Attributor] Fixpoint iteration done after: "
                     << IterationCounter << "/" << MaxIterations
                     << " iterations\n");
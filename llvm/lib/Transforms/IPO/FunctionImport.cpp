@@ -37,7 +37,9 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/IPO/Internalize.h"
 #include "llvm/Transforms/Utils/Cloning.h"
@@ -582,7 +584,10 @@ static void computeImportForFunction(
 
     const auto AdjThreshold = GetAdjustedThreshold(Threshold, IsHotCallsite);
 
-    ImportCount++;
+    // The cutoff counts imports across all modules, which forces the import
+    // computation to be serial; only maintain the counter when it is needed.
+    if (ImportCutoff >= 0)
+      ImportCount++;
 
     // Insert the newly imported function to the worklist.
     Worklist.emplace_back(ResolvedCalleeSummary, AdjThreshold);
@@ -732,22 +737,62 @@ void llvm::ComputeCrossModuleImport(
         isPrevailing,
     DenseMap<StringRef, FunctionImporter::ImportMapTy> &ImportLists,
     DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists) {
-  ModuleImportsManager MIS(isPrevailing, Index, &ExportLists);
+  llvm::TimeTraceScope timeScope("Compute cross-module imports");
+
+  // Create the import list of every module up front so that the references
+  // into ImportLists stay valid while the modules are processed.
+  struct ModuleImportInfo {
+    StringRef ModName;
+    const GVSummaryMapTy *DefinedGVSummaries;
+    FunctionImporter::ImportMapTy *ImportList;
+    DenseMap<StringRef, FunctionImporter::ExportSetTy> ExportLists;
+  };
+  std::vector<ModuleImportInfo> Modules;
+  Modules.reserve(ModuleToDefinedGVSummaries.size());
+  for (const auto &DefinedGVSummaries : ModuleToDefinedGVSummaries)
+    Modules.push_back({DefinedGVSummaries.first, &DefinedGVSummaries.second,
+                       &ImportLists[DefinedGVSummaries.first], {}});
+
   // For each module that has function defined, compute the import/export lists.
-  for (const auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
-    auto &ImportList = ImportLists[DefinedGVSummaries.first];
-    LLVM_DEBUG(dbgs() << "Computing import for Module '"
-                      << DefinedGVSummaries.first << "'\n");
-    MIS.computeImportForModule(DefinedGVSummaries.second,
-                               DefinedGVSummaries.first, ImportList);
+  // This only reads the index and calls isPrevailing, which must be
+  // thread-safe, so modules are processed in parallel, each recording its
+  // exports in a module-local map. -import-cutoff counts imports
+  // across modules and the diagnostic options print while walking, so those
+  // require the serial walk.
+  auto ComputeForModule = [&](ModuleImportInfo &MI) {
+    LLVM_DEBUG(dbgs() << "Computing import for Module '" << MI.ModName
+                      << "'\n");
+    ModuleImportsManager MIS(isPrevailing, Index, &MI.ExportLists);
+    MIS.computeImportForModule(*MI.DefinedGVSummaries, MI.ModName,
+                               *MI.ImportList);
+  };
+  if (ImportCutoff < 0 && !PrintImportFailures && !ForceImportAll &&
+      !DebugFlag)
+    parallelForEach(Modules, ComputeForModule);
+  else
+    llvm::for_each(Modules, ComputeForModule);
+
+  // Merge the exports in module order so that the result does not depend on
+  // scheduling.
+  for (ModuleImportInfo &MI : Modules) {
+    for (auto &ELI : MI.ExportLists)
+      ExportLists[ELI.first].insert(ELI.second.begin(), ELI.second.end());
+    MI.ExportLists.clear();
   }
 
   // When computing imports we only added the variables and functions being
   // imported to the export list. We also need to mark any references and calls
   // they make as exported as well. We do this here, as it is more efficient
   // since we may import the same values multiple times into different modules
-  // during the import computation.
-  for (auto &ELI : ExportLists) {
+  // during the import computation. Each exporting module only updates its own
+  // export list, so this is done in parallel too.
+  std::vector<DenseMap<StringRef, FunctionImporter::ExportSetTy>::value_type *>
+      ExportEntries;
+  ExportEntries.reserve(ExportLists.size());
+  for (auto &ELI : ExportLists)
+    ExportEntries.push_back(&ELI);
+  parallelForEach(ExportEntries, [&](auto *Entry) {
+    auto &ELI = *Entry;
     FunctionImporter::ExportSetTy NewExports;
     const auto &DefinedGVSummaries =
         ModuleToDefinedGVSummaries.lookup(ELI.first);
@@ -791,7 +836,7 @@ void llvm::ComputeCrossModuleImport(
         ++EI;
     }
     ELI.second.insert(NewExports.begin(), NewExports.end());
-  }
+  });
 
   assert(checkVariableImport(Index, ImportLists, ExportLists));
 #ifndef NDEBUG
@@ -108,6 +108,19 @@ cl::opt<bool> AtomicCounterUpdatePromoted(
              " for promoted counters only"),
     cl::init(false));
 
+cl::opt<bool> SampledInstr(
+    "sampled-instrumentation",
+    cl::desc("Only update profile counters during short bursts to reduce the "
+             "overhead of instrumentation"),
+    cl::init(false));
+
+cl::opt<unsigned> SampledInstrBurstDuration(
+    "sampled-instr-burst-duration",
+    cl::desc("With -sampled-instrumentation, the number of consecutive "
+             "counter updates of a thread that are recorded out of every "
+             "65536"),
+    cl::init(200));
+
 cl::opt<bool> AtomicFirstCounter(
     "atomic-first-counter",
     cl::desc("Use atomic fetch add for first counter in a function (usually "
@@ -422,6 +435,7 @@ PreservedAnalyses InstrProfiling::run(Module &M, ModuleAnalysisManager &AM) {
 bool InstrProfiling::lowerIntrinsics(Function *F) {
   bool MadeChange = false;
   PromotionCandidates.clear();
+  SampledIncrements.clear();
   for (BasicBlock &BB : *F) {
     for (Instruction &Instr : llvm::make_early_inc_range(BB)) {
       if (auto *IPIS = dyn_cast<InstrProfIncrementInstStep>(&Instr)) {
@@ -455,6 +469,7 @@ bool InstrProfiling::lowerIntrinsics(Function *F) {
   if (!MadeChange)
     return false;
 
+  lowerSampledIncrements();
   promoteCounterLoadStores(F);
   return true;
 }
@@ -774,10 +789,57 @@ void InstrProfiling::lowerTimestamp(
   TimestampInstruction->eraseFromParent();
 }
 
+GlobalVariable *InstrProfiling::getOrCreateSamplingVar() {
+  const StringRef VarName = "__llvm_profile_sampling";
+  if (GlobalVariable *SamplingVar = M->getNamedGlobal(VarName))
+    return SamplingVar;
+  auto *Int16Ty = Type::getInt16Ty(M->getContext());
+  auto *SamplingVar = new GlobalVariable(
+      *M, Int16Ty, false, GlobalValue::LinkOnceODRLinkage,
+      Constant::getNullValue(Int16Ty), VarName, nullptr,
+      GlobalValue::GeneralDynamicTLSModel);
+  SamplingVar->setVisibility(GlobalVariable::HiddenVisibility);
+  // Share one sampling counter between all the modules of a linked image.
+  if (TT.supportsCOMDAT())
+    SamplingVar->setComdat(M->getOrInsertComdat(SamplingVar->getName()));
+  return SamplingVar;
+}
+
+void InstrProfiling::lowerSampledIncrements() {
+  for (auto [InBurst, LastUpdate] : SampledIncrements) {
+    Instruction *FirstUpdate = InBurst->getNextNode();
+    Instruction *ThenTerm =
+        SplitBlockAndInsertIfThen(InBurst, FirstUpdate, /*Unreachable=*/false);
+    for (Instruction *I = FirstUpdate, *Next;; I = Next) {
+      Next = I->getNextNode();
+      I->moveBefore(ThenTerm);
+      if (I == LastUpdate)
+        break;
+    }
+  }
+}
+
 void InstrProfiling::lowerIncrement(InstrProfIncrementInst *Inc) {
   auto *Addr = getCounterAddress(Inc);
 
   IRBuilder<> Builder(Inc);
+  Instruction *InBurst = nullptr;
+  if (SampledInstr) {
+    // Every update advances the thread's sampling counter, which wraps around
+    // every 65536 updates. The counter itself is only updated while the
+    // sampling counter is below the burst duration. The update is moved under
+    // this check once the whole function has been lowered.
+    auto *Int16Ty = Builder.getInt16Ty();
+    Value *SamplingAddr =
+        Builder.CreateThreadLocalAddress(getOrCreateSamplingVar());
+    Value *Sample = Builder.CreateLoad(Int16Ty, SamplingAddr, "pgosample");
+    Builder.CreateStore(Builder.CreateAdd(Sample, Builder.getInt16(1)),
+                        SamplingAddr);
+    InBurst = cast<Instruction>(Builder.CreateICmpULT(
+        Sample, Builder.getInt16(std::min<unsigned>(SampledInstrBurstDuration,
+                                                    UINT16_MAX))));
+  }
+
   if (Options.Atomic || AtomicCounterUpdateAll ||
       (Inc->getIndex()->isZeroValue() && AtomicFirstCounter)) {
     Builder.CreateAtomicRMW(AtomicRMWInst::Add, Addr, Inc->getStep(),
@@ -787,9 +849,12 @@ void InstrProfiling::lowerIncrement(InstrProfIncrementInst *Inc) {
     Value *Load = Builder.CreateLoad(IncStep->getType(), Addr, "pgocount");
     auto *Count = Builder.CreateAdd(Load, Inc->getStep());
     auto *Store = Builder.CreateStore(Count, Addr);
-    if (isCounterPromotionEnabled())
+    // A sampled update is conditional, so it can't be promoted.
+    if (isCounterPromotionEnabled() && !InBurst)
       PromotionCandidates.emplace_back(cast<Instruction>(Load), Store);
   }
+  if (InBurst)
+    SampledIncrements.emplace_back(InBurst, Inc->getPrevNode());
   Inc->eraseFromParent();
 }
 
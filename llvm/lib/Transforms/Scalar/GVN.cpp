@@ -134,6 +134,12 @@ static cl::opt<uint32_t> MaxNumInsnsPerBlock(
     cl::desc("Max number of instructions to scan in each basic block in GVN "
              "(default = 100)"));
 
+static cl::opt<uint32_t> MaxFunctionSize(
+    "gvn-max-function-size", cl::Hidden, cl::init(0),
+    cl::desc("Skip GVN on functions with more than this many instructions, "
+             "relying on the cheaper redundancy elimination done earlier in "
+             "the pipeline (default = 0, no limit)"));
+
 struct llvm::GVNPass::Expression {
   uint32_t opcode;
   bool commutative = false;
@@ -2688,6 +2694,25 @@ bool GVNPass::runImpl(Function &F, AssumptionCache &RunAC, DominatorTree &RunDT,
                       const TargetLibraryInfo &RunTLI, AAResults &RunAA,
                       MemoryDependenceResults *RunMD, LoopInfo &LI,
                       OptimizationRemarkEmitter *RunORE, MemorySSA *MSSA) {
+  // GVN's compile time grows superlinearly on very large functions; give up
+  // on them rather than let a single generated function dominate a build.
+  if (MaxFunctionSize) {
+    unsigned NumInsts = F.getInstructionCount();
+    if (NumInsts > MaxFunctionSize) {
+      LLVM_DEBUG(dbgs() << "GVN: skipping " << F.getName() << " with "
+                        << NumInsts << " instructions\n");
+      if (RunORE)
+        RunORE->emit([&]() {
+          return OptimizationRemarkMissed(DEBUG_TYPE, "FunctionTooLarge", &F)
+                 << "GVN skipped on function with "
+                 << ore::NV("NumInstructions", NumInsts)
+                 << " instructions, exceeding the limit of "
+                 << ore::NV("Limit", MaxFunctionSize.getValue());
+        });
+      return false;
+    }
+  }
+
   AC = &RunAC;
   DT = &RunDT;
   VN.setDomTree(DT);
@@ -31,6 +31,7 @@
 #include "llvm/IR/User.h"
 #include "llvm/IR/Value.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MD5.h"
@@ -49,6 +50,11 @@ using namespace llvm;
 
 #define DEBUG_TYPE "split-module"
 
+static cl::opt<bool> BalanceAllFunctions(
+    "split-module-balance-functions", cl::init(false), cl::Hidden,
+    cl::desc("Place every function definition by estimated codegen cost "
+             "instead of by the hash of its name"));
+
 namespace {
 
 using ClusterMapType = EquivalenceClasses<const GlobalValue *>;
@@ -96,10 +102,19 @@ static const GlobalObject *getGVPartitioningRoot(const GlobalValue *GV) {
   return GO;
 }
 
+// Estimate the cost of code generation for a global value: the number of
+// instructions of a function, and one for any other definition.
+static uint64_t getGVCost(const GlobalValue *GV) {
+  if (const auto *F = dyn_cast<Function>(GV))
+    return std::max(1u, F->getInstructionCount());
+  return 1;
+}
+
 // Find partitions for module in the way that no locals need to be
 // globalized.
-// Try to balance pack those partitions into N files since this roughly equals
-// thread balancing for the backend codegen step.
+// Try to balance pack those partitions into N files by their estimated code
+// generation cost since this roughly equals thread balancing for the backend
+// codegen step.
 static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
                            unsigned N) {
   // At this point module should have the proper mix of globals and locals.
@@ -116,6 +131,13 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
     if (!GV.hasName())
       GV.setName("__llvmsplit_unnamed");
 
+    // With -split-module-balance-functions, every function definition takes
+    // part in the balancing below, even if it is not clustered with anything
+    // else. This makes the partition of a function depend on the rest of the
+    // module, so by default unclustered functions are placed by hash.
+    if (BalanceAllFunctions && isa<Function>(GV))
+      GVtoClusterMap.insert(&GV);
+
     // Comdat groups must not be partitioned. For comdat groups that contain
     // locals, record all their members here so we can keep them together.
     // Comdat groups that only contain external globals are already handled by
@@ -151,37 +173,41 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
   llvm::for_each(M.globals(), recordGVSet);
   llvm::for_each(M.aliases(), recordGVSet);
 
-  // Assigned all GVs to merged clusters while balancing number of objects in
+  // Assigned all GVs to merged clusters while balancing the estimated cost of
   // each.
-  auto CompareClusters = [](const std::pair<unsigned, unsigned> &a,
-                            const std::pair<unsigned, unsigned> &b) {
+  auto CompareClusters = [](const std::pair<unsigned, uint64_t> &a,
+                            const std::pair<unsigned, uint64_t> &b) {
     if (a.second || b.second)
       return a.second > b.second;
     else
       return a.first > b.first;
   };
 
-  std::priority_queue<std::pair<unsigned, unsigned>,
-                      std::vector<std::pair<unsigned, unsigned>>,
+  std::priority_queue<std::pair<unsigned, uint64_t>,
+                      std::vector<std::pair<unsigned, uint64_t>>,
                       decltype(CompareClusters)>
       BalancinQueue(CompareClusters);
   // Pre-populate priority queue with N slot blanks.
   for (unsigned i = 0; i < N; ++i)
     BalancinQueue.push(std::make_pair(i, 0));
 
-  using SortType = std::pair<unsigned, ClusterMapType::iterator>;
+  using SortType = std::pair<uint64_t, ClusterMapType::iterator>;
 
   SmallVector<SortType, 64> Sets;
   SmallPtrSet<const GlobalValue *, 32> Visited;
 
-  // To guarantee determinism, we have to sort SCC according to size.
-  // When size is the same, use leader's name.
+  // To guarantee determinism, we have to sort SCC according to cost.
+  // When cost is the same, use leader's name.
   for (ClusterMapType::iterator I = GVtoClusterMap.begin(),
-                                E = GVtoClusterMap.end(); I != E; ++I)
-    if (I->isLeader())
-      Sets.push_back(
-          std::make_pair(std::distance(GVtoClusterMap.member_begin(I),
-                                       GVtoClusterMap.member_end()), I));
+                                E = GVtoClusterMap.end(); I != E; ++I) {
+    if (!I->isLeader())
+      continue;
+    uint64_t Cost = 0;
+    for (ClusterMapType::member_iterator MI = GVtoClusterMap.member_begin(I);
+         MI != GVtoClusterMap.member_end(); ++MI)
+      Cost += getGVCost(*MI);
+    Sets.push_back(std::make_pair(Cost, I));
+  }
 
   llvm::sort(Sets, [](const SortType &a, const SortType &b) {
     if (a.first == b.first)
@@ -192,10 +218,10 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
 
   for (auto &I : Sets) {
     unsigned CurrentClusterID = BalancinQueue.top().first;
-    unsigned CurrentClusterSize = BalancinQueue.top().second;
+    uint64_t CurrentClusterCost = BalancinQueue.top().second;
     BalancinQueue.pop();
 
-    LLVM_DEBUG(dbgs() << "Root[" << CurrentClusterID << "] cluster_size("
+    LLVM_DEBUG(dbgs() << "Root[" << CurrentClusterID << "] cluster_cost("
                       << I.first << ") ----> " << I.second->getData()->getName()
                       << "\n");
 
@@ -208,10 +234,10 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
                         << ((*MI)->hasLocalLinkage() ? " l " : " e ") << "\n");
       Visited.insert(*MI);
       ClusterIDMap[*MI] = CurrentClusterID;
-      CurrentClusterSize++;
     }
-    // Add this set size to the number of entries in this cluster.
-    BalancinQueue.push(std::make_pair(CurrentClusterID, CurrentClusterSize));
+    // Add the cost of this set to the cost of this cluster.
+    BalancinQueue.push(
+        std::make_pair(CurrentClusterID, CurrentClusterCost + I.first));
   }
 }
 
@@ -106,6 +106,9 @@ using namespace slpvectorizer;
 #define DEBUG_TYPE "SLP"
 
 STATISTIC(NumVectorInstructions, "Number of vector instructions generated");
+STATISTIC(NumTreesBuilt, "Number of vectorizable trees built");
+STATISTIC(NumTreesOverBudget,
+          "Number of trees that were cut off at the maximum tree size");
 
 static cl::opt<bool>
     RunSLPVectorization("vectorize-slp", cl::init(true), cl::Hidden,
@@ -156,6 +159,12 @@ static cl::opt<unsigned> RecursionMaxDepth(
     "slp-recursion-max-depth", cl::init(12), cl::Hidden,
     cl::desc("Limit the recursion depth when building a vectorizable tree"));
 
+static cl::opt<unsigned> MaxTreeSize(
+    "slp-max-tree-size", cl::init(0), cl::Hidden,
+    cl::desc("Gather the remaining operands once a vectorizable tree has this "
+             "many nodes, to bound compile time on large straight-line code "
+             "(default = 0, no limit)"));
+
 static cl::opt<unsigned> MinTreeSize(
     "slp-min-tree-size", cl::init(3), cl::Hidden,
     cl::desc("Only vectorize small trees if they are fully vectorizable"));
@@ -5135,6 +5144,7 @@ void BoUpSLP::buildTree(ArrayRef<Value *> Roots,
   UserIgnoreList = &UserIgnoreLst;
   if (!allSameType(Roots))
     return;
+  ++NumTreesBuilt;
   buildTree_rec(Roots, 0, EdgeInfo());
 }
 
@@ -5142,6 +5152,7 @@ void BoUpSLP::buildTree(ArrayRef<Value *> Roots) {
   deleteTree();
   if (!allSameType(Roots))
     return;
+  ++NumTreesBuilt;
   buildTree_rec(Roots, 0, EdgeInfo());
 }
 
@@ -5639,6 +5650,16 @@ void BoUpSLP::buildTree_rec(ArrayRef<Value *> VL, unsigned Depth,
     }
   }
 
+  // Gather if the tree already reached its size budget. The remaining operands
+  // are treated as external inputs, which keeps what was built so far usable.
+  if (MaxTreeSize && VectorizableTree.size() >= MaxTreeSize) {
+    LLVM_DEBUG(dbgs() << "SLP: Gathering due to max tree size.\n");
+    if (VectorizableTree.size() == MaxTreeSize)
+      ++NumTreesOverBudget;
+    newTreeEntry(VL, std::nullopt /*not vectorized*/, S, UserTreeIdx);
+    return;
+  }
+
   // Gather if we hit the RecursionMaxDepth, unless this is a load (or z/sext of
   // a load), in which case peek through to include it in the tree, without
   // ballooning over-budget.
@@ -271,6 +271,11 @@ static opt<bool> Verify("verify", desc("Verify the DWARF debug info."),
                         cat(DwarfDumpCategory));
 static opt<bool> Quiet("quiet", desc("Use with -verify to not emit to STDOUT."),
                        cat(DwarfDumpCategory));
+static opt<bool> ErrorSummary(
+    "error-summary",
+    desc("Use with -verify to print the number of errors in each section "
+         "instead of every error."),
+    cat(DwarfDumpCategory));
 static opt<bool> DumpUUID("uuid", desc("Show the UUID for each architecture."),
                           cat(DwarfDumpCategory));
 static alias DumpUUIDAlias("u", desc("Alias for --uuid."), aliasopt(DumpUUID),
@@ -319,6 +324,7 @@ static DIDumpOptions getDumpOpts(DWARFContext &C) {
   // In -verify mode, print DIEs without children in error messages.
   if (Verify) {
     DumpOpts.Verbose = true;
+    DumpOpts.ShowAggregateErrors = ErrorSummary;
     return DumpOpts.noImplicitRecursion();
   }
   return DumpOpts;
@@ -829,17 +829,21 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
     Pool.wait();
 
     // Merge the writer contexts together (~ lg(NumThreads) serial steps).
+    // Release each context as soon as it has been merged into another one,
+    // instead of keeping its function maps alive until the output is written.
+    auto MergeAndRelease = [&Contexts](unsigned Dst, unsigned Src) {
+      mergeWriterContexts(Contexts[Dst].get(), Contexts[Src].get());
+      Contexts[Src].reset();
+    };
     unsigned Mid = Contexts.size() / 2;
     unsigned End = Contexts.size();
     assert(Mid > 0 && "Expected more than one context");
     do {
       for (unsigned I = 0; I < Mid; ++I)
-        Pool.async(mergeWriterContexts, Contexts[I].get(),
-                   Contexts[I + Mid].get());
+        Pool.async(MergeAndRelease, I, I + Mid);
       Pool.wait();
       if (End & 1) {
-        Pool.async(mergeWriterContexts, Contexts[0].get(),
-                   Contexts[End - 1].get());
+        Pool.async(MergeAndRelease, 0, End - 1);
         Pool.wait();
       }
       End = Mid;
@@ -851,6 +855,8 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
   // is equal to the number of inputs the merge failed.
   unsigned NumErrors = 0;
   for (std::unique_ptr<WriterContext> &WC : Contexts) {
+    if (!WC)
+      continue;
     for (auto &ErrorPair : WC->Errors) {
       ++NumErrors;
       warn(toString(std::move(ErrorPair.first)), ErrorPair.second);
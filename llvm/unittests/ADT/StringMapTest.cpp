@@ -323,6 +323,29 @@ TEST_F(StringMapTest, InsertOrAssignTest) {
   EXPECT_EQ(0, try1.first->second.copy);
 }
 
+TEST_F(StringMapTest, PrecomputedHashTest) {
+  StringMap<int> Map;
+  uint32_t EinsHash = StringMap<int>::hash("eins");
+  uint32_t ZweiHash = StringMap<int>::hash("zwei");
+
+  auto Try1 = Map.try_emplace_with_hash("eins", EinsHash, 1);
+  EXPECT_TRUE(Try1.second);
+  EXPECT_EQ(1, Try1.first->second);
+  auto Try2 = Map.try_emplace_with_hash("eins", EinsHash, 2);
+  EXPECT_FALSE(Try2.second);
+  EXPECT_EQ(Try1.first, Try2.first);
+  Map.try_emplace("zwei", 2);
+
+  EXPECT_EQ(2u, Map.size());
+  EXPECT_EQ(1, Map.find("eins", EinsHash)->second);
+  EXPECT_EQ(2, Map.find("zwei", ZweiHash)->second);
+  EXPECT_EQ(Map.find("zwei"), Map.find("zwei", ZweiHash));
+  EXPECT_EQ(Map.end(), Map.find("drei", StringMap<int>::hash("drei")));
+
+  const StringMap<int> &ConstMap = Map;
+  EXPECT_EQ(1, ConstMap.find("eins", EinsHash)->second);
+}
+
 TEST_F(StringMapTest, IterMapKeysVector) {
   StringMap<int> Map;
   Map["A"] = 1;
@@ -1463,6 +1463,50 @@ TEST(DWARFDebugInfo, TestEmptyChildren) {
   EXPECT_EQ(CUDie.begin(), CUDie.end());
 }
 
+TEST(DWARFDebugInfo, TestVerifyErrorSummary) {
+  // Two abbreviation declarations that each contain DW_AT_name twice.
+  const char *yamldata = "debug_abbrev:\n"
+                         "  - Table:\n"
+                         "      - Code:            0x00000001\n"
+                         "        Tag:             DW_TAG_compile_unit\n"
+                         "        Children:        DW_CHILDREN_no\n"
+                         "        Attributes:\n"
+                         "          - Attribute:       DW_AT_name\n"
+                         "            Form:            DW_FORM_string\n"
+                         "          - Attribute:       DW_AT_name\n"
+                         "            Form:            DW_FORM_string\n"
+                         "      - Code:            0x00000002\n"
+                         "        Tag:             DW_TAG_subprogram\n"
+                         "        Children:        DW_CHILDREN_no\n"
+                         "        Attributes:\n"
+                         "          - Attribute:       DW_AT_name\n"
+                         "            Form:            DW_FORM_string\n"
+                         "          - Attribute:       DW_AT_name\n"
+                         "            Form:            DW_FORM_string\n";
+
+  auto ErrOrSections = DWARFYAML::emitDebugSections(StringRef(yamldata));
+  ASSERT_TRUE((bool)ErrOrSections);
+  std::unique_ptr<DWARFContext> DwarfContext =
+      DWARFContext::create(*ErrOrSections, 8);
+
+  // Every error is reported individually by default.
+  std::string Details;
+  raw_string_ostream DetailsOS(Details);
+  EXPECT_FALSE(DwarfContext->verify(DetailsOS, DIDumpOptions()));
+  EXPECT_EQ(StringRef(Details).count("error: "), 2u);
+
+  // The summary counts the same errors without printing them.
+  DIDumpOptions DumpOpts;
+  DumpOpts.ShowAggregateErrors = true;
+  std::string Summary;
+  raw_string_ostream SummaryOS(Summary);
+  EXPECT_FALSE(DwarfContext->verify(SummaryOS, DumpOpts));
+  EXPECT_EQ(StringRef(Summary).count("error: "), 0u);
+  EXPECT_NE(Summary.find("Summary of errors by section:\n"
+                         "       2 .debug_abbrev\n"),
+            std::string::npos);
+}
+
 TEST(DWARFDebugInfo, TestAttributeIterators) {
   Triple Triple = getNormalizedDefaultTargetTriple();
   if (!isConfigurationSupported(Triple))
@@ -0,0 +1,126 @@
+//===- SplitModuleTest.cpp - Unit tests for SplitModule -------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Transforms/Utils/SplitModule.h"
+#include "llvm/ADT/ScopeExit.h"
+#include "llvm/AsmParser/Parser.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/SourceMgr.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+static std::unique_ptr<Module> parseIR(LLVMContext &C, const char *IR) {
+  SMDiagnostic Err;
+  std::unique_ptr<Module> Mod = parseAssemblyString(IR, Err, C);
+  if (!Mod)
+    Err.print("SplitModuleTests", errs());
+  return Mod;
+}
+
+static SmallVector<SmallVector<std::string, 4>, 2>
+splitFunctions(Module &M, unsigned N, bool PreserveLocals) {
+  SmallVector<SmallVector<std::string, 4>, 2> Partitions;
+  SplitModule(
+      M, N,
+      [&](std::unique_ptr<Module> MPart) {
+        SmallVector<std::string, 4> &Defs = Partitions.emplace_back();
+        for (const Function &F : *MPart)
+          if (!F.isDeclaration())
+            Defs.push_back(F.getName().str());
+      },
+      PreserveLocals);
+  return Partitions;
+}
+
+// Clusters are balanced across partitions by their instruction count, so the
+// large cluster ends up alone while the small ones share the other partition.
+TEST(SplitModuleTest, BalanceClustersByCost) {
+  LLVMContext C;
+  std::unique_ptr<Module> M = parseIR(C, R"(
+    define internal i32 @big_impl(i32 %x) {
+      %a1 = add i32 %x, 1
+      %a2 = add i32 %a1, 2
+      %a3 = add i32 %a2, 3
+      %a4 = add i32 %a3, 4
+      %a5 = add i32 %a4, 5
+      %a6 = add i32 %a5, 6
+      %a7 = add i32 %a6, 7
+      %a8 = add i32 %a7, 8
+      ret i32 %a8
+    }
+    define i32 @big(i32 %x) {
+      %r = call i32 @big_impl(i32 %x)
+      ret i32 %r
+    }
+    define internal void @h1() {
+      ret void
+    }
+    define void @s1() {
+      call void @h1()
+      ret void
+    }
+    define internal void @h2() {
+      ret void
+    }
+    define void @s2() {
+      call void @h2()
+      ret void
+    }
+  )");
+  ASSERT_TRUE(M);
+
+  auto Partitions = splitFunctions(*M, 2, /*PreserveLocals=*/true);
+  ASSERT_EQ(Partitions.size(), 2u);
+  EXPECT_EQ(Partitions[0], SmallVector<std::string, 4>({"big_impl", "big"}));
+  EXPECT_EQ(Partitions[1],
+            SmallVector<std::string, 4>({"h1", "s1", "h2", "s2"}));
+}
+
+// With -split-module-balance-functions, unclustered functions are balanced by
+// cost too instead of being placed by the hash of their name.
+TEST(SplitModuleTest, BalanceAllFunctionsByCost) {
+  auto *Opt = static_cast<cl::opt<bool> *>(
+      cl::getRegisteredOptions()["split-module-balance-functions"]);
+  ASSERT_TRUE(Opt);
+  Opt->setValue(true);
+  auto Restore = make_scope_exit([&] { Opt->setValue(false); });
+
+  LLVMContext C;
+  std::unique_ptr<Module> M = parseIR(C, R"(
+    define i32 @big(i32 %x) {
+      %a1 = add i32 %x, 1
+      %a2 = add i32 %a1, 2
+      %a3 = add i32 %a2, 3
+      %a4 = add i32 %a3, 4
+      %a5 = add i32 %a4, 5
+      %a6 = add i32 %a5, 6
+      %a7 = add i32 %a6, 7
+      %a8 = add i32 %a7, 8
+      ret i32 %a8
+    }
+    define void @small1() {
+      ret void
+    }
+    define void @small2() {
+      ret void
+    }
+    define void @small3() {
+      ret void
+    }
+  )");
+  ASSERT_TRUE(M);
+
+  auto Partitions = splitFunctions(*M, 2, /*PreserveLocals=*/false);
+  ASSERT_EQ(Partitions.size(), 2u);
+  EXPECT_EQ(Partitions[0], SmallVector<std::string, 4>({"big"}));
+  EXPECT_EQ(Partitions[1],
+            SmallVector<std::string, 4>({"small1", "small2", "small3"}));
+}
@@ -24,6 +24,49 @@
 
 namespace mlir {
 
+namespace detail {
+/// Invoke `func` with the indices of `numElements` elements asynchronously,
+/// starting the n-th task with the element index `getIndex(n)`. Diagnostics
+/// emitted while processing an element are ordered relative to its index. If
+/// `func` returns a failure for any element, execution is stopped and a failure
+/// is returned.
+template <typename IndexFuncT, typename FuncT>
+LogicalResult failableParallelForEachIndex(MLIRContext *context,
+                                           unsigned numElements,
+                                           IndexFuncT &&getIndex,
+                                           FuncT &&func) {
+  // Build a wrapper processing function that properly initializes a parallel
+  // diagnostic handler.
+  ParallelDiagnosticHandler handler(context);
+  std::atomic<unsigned> curIndex(0);
+  std::atomic<bool> processingFailed(false);
+  auto processFn = [&] {
+    while (!processingFailed) {
+      unsigned n = curIndex++;
+      if (n >= numElements)
+        break;
+      unsigned index = getIndex(n);
+      handler.setOrderIDForThread(index);
+      if (failed(func(index)))
+        processingFailed = true;
+      handler.eraseOrderIDForThread();
+    }
+  };
+
+  // Process the elements in parallel.
+  llvm::ThreadPool &threadPool = context->getThreadPool();
+  llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
+  size_t numActions = std::min(numElements, threadPool.getThreadCount());
+  for (unsigned i = 0; i < numActions; ++i)
+    tasksGroup.async(processFn);
+  // If the current thread is a worker thread from the pool, then waiting for
+  // the task group allows the current thread to also participate in processing
+  // tasks from the group, which avoid any deadlock/starvation.
+  tasksGroup.wait();
+  return failure(processingFailed);
+}
+} // namespace detail
+
 /// Invoke the given function on the elements between [begin, end)
 /// asynchronously. If the given function returns a failure when processing any
 /// of the elements, execution is stopped and a failure is returned from this
@@ -48,34 +91,33 @@ LogicalResult failableParallelForEach(MLIRContext *context, IteratorT begin,
     return success();
   }
 
-  // Build a wrapper processing function that properly initializes a parallel
-  // diagnostic handler.
-  ParallelDiagnosticHandler handler(context);
-  std::atomic<unsigned> curIndex(0);
-  std::atomic<bool> processingFailed(false);
-  auto processFn = [&] {
-    while (!processingFailed) {
-      unsigned index = curIndex++;
-      if (index >= numElements)
-        break;
-      handler.setOrderIDForThread(index);
-      if (failed(func(*std::next(begin, index))))
-        processingFailed = true;
-      handler.eraseOrderIDForThread();
-    }
-  };
+  return detail::failableParallelForEachIndex(
+      context, numElements, [](unsigned n) { return n; },
+      [&](unsigned index) { return func(*std::next(begin, index)); });
+}
 
-  // Otherwise, process the elements in parallel.
-  llvm::ThreadPool &threadPool = context->getThreadPool();
-  llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
-  size_t numActions = std::min(numElements, threadPool.getThreadCount());
-  for (unsigned i = 0; i < numActions; ++i)
-    tasksGroup.async(processFn);
-  // If the current thread is a worker thread from the pool, then waiting for
-  // the task group allows the current thread to also participate in processing
-  // tasks from the group, which avoid any deadlock/starvation.
-  tasksGroup.wait();
-  return failure(processingFailed);
+/// Invoke the given function on the elements between [begin, end)
+/// asynchronously, like the above, but start processing the elements in the
+/// order given by `order`, a permutation of the element indices. This allows
+/// for scheduling expensive elements first. Diagnostics emitted during
+/// processing are still ordered relative to the element's position within
+/// [begin, end). If the provided context does not have multi-threading
+/// enabled, this function processes elements sequentially in their original
+/// order.
+template <typename IteratorT, typename FuncT>
+LogicalResult failableParallelForEach(MLIRContext *context, IteratorT begin,
+                                      IteratorT end, ArrayRef<unsigned> order,
+                                      FuncT &&func) {
+  unsigned numElements = static_cast<unsigned>(std::distance(begin, end));
+  assert(order.size() == numElements &&
+         "expected the order to be a permutation of the elements");
+  if (!context->isMultithreadingEnabled() || numElements <= 1)
+    return failableParallelForEach(context, begin, end,
+                                   std::forward<FuncT>(func));
+
+  return detail::failableParallelForEachIndex(
+      context, numElements, [&](unsigned n) { return order[n]; },
+      [&](unsigned index) { return func(*std::next(begin, index)); });
 }
 
 /// Invoke the given function on the elements in the provided range
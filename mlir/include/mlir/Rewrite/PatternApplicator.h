@@ -17,6 +17,8 @@
 #include "mlir/Rewrite/FrozenRewritePatternSet.h"
 
 #include "mlir/IR/Action.h"
+#include "llvm/ADT/MapVector.h"
+#include "llvm/Config/abi-breaking.h"
 
 namespace mlir {
 class PatternRewriter;
@@ -94,6 +96,19 @@ private:
   SmallVector<const RewritePattern *, 1> anyOpPatterns;
   /// The mutable state used during execution of the PDL bytecode.
   std::unique_ptr<detail::PDLByteCodeMutableState> mutableByteCodeState;
+
+#if LLVM_ENABLE_ABI_BREAKING_CHECKS
+  /// The number of times a pattern was attempted, succeeded, and was rejected
+  /// by `canApply`.
+  struct PatternCounts {
+    unsigned numAttempts = 0;
+    unsigned numSuccesses = 0;
+    unsigned numFiltered = 0;
+  };
+  /// The counts of each pattern that was considered, reported in the debug
+  /// output of "pattern-application" when the applicator is destroyed.
+  llvm::MapVector<const Pattern *, PatternCounts> patternCounts;
+#endif
 };
 
 } // namespace mlir
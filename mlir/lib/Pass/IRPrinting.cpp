@@ -162,6 +162,25 @@ void PassManager::IRPrinterConfig::printAfterIfEnabled(
 //===----------------------------------------------------------------------===//
 
 namespace {
+/// A stream that buffers the output of a single IR dump before forwarding it to
+/// an unbuffered stream, e.g. llvm::errs(). Without this, every token printed
+/// results in a separate write to the underlying file.
+class BufferedForwardingStream : public raw_ostream {
+public:
+  BufferedForwardingStream(raw_ostream &os) : os(os) {
+    SetBufferSize(64 * 1024);
+  }
+  ~BufferedForwardingStream() override { flush(); }
+
+private:
+  void write_impl(const char *ptr, size_t size) override {
+    os.write(ptr, size);
+  }
+  uint64_t current_pos() const override { return os.tell(); }
+
+  raw_ostream &os;
+};
+
 /// Simple wrapper config that allows for the simpler interface defined above.
 struct BasicIRPrinterConfig : public PassManager::IRPrinterConfig {
   BasicIRPrinterConfig(
@@ -181,13 +200,22 @@ struct BasicIRPrinterConfig : public PassManager::IRPrinterConfig {
   void printBeforeIfEnabled(Pass *pass, Operation *operation,
                             PrintCallbackFn printCallback) final {
     if (shouldPrintBeforePass && shouldPrintBeforePass(pass, operation))
-      printCallback(out);
+      print(printCallback);
   }
 
   void printAfterIfEnabled(Pass *pass, Operation *operation,
                            PrintCallbackFn printCallback) final {
     if (shouldPrintAfterPass && shouldPrintAfterPass(pass, operation))
-      printCallback(out);
+      print(printCallback);
+  }
+
+  /// Invoke the print callback on the output stream, buffering the output if
+  /// the stream isn't buffered itself.
+  void print(PrintCallbackFn printCallback) {
+    if (out.GetBufferSize() != 0)
+      return printCallback(out);
+    BufferedForwardingStream bufferedOut(out);
+    printCallback(bufferedOut);
   }
 
   /// Filter functions for before and after pass execution.
@@ -20,6 +20,7 @@
 #include "mlir/Support/FileUtilities.h"
 #include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Sequence.h"
 #include "llvm/ADT/ScopeExit.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/CrashRecoveryContext.h"
@@ -805,8 +806,33 @@ void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
     return pipelineResult;
   };
 
+  // Schedule the largest operations first. Otherwise a large operation near
+  // the end of the list can keep a single thread busy long after the others
+  // have run out of work. Diagnostics are still ordered by the position of the
+  // operations. The size is estimated by the number of operations directly
+  // nested in each operation, as walking all of the IR here would add serial
+  // work to every run of the adaptor.
+  SmallVector<unsigned> schedule =
+      llvm::to_vector(llvm::seq<unsigned>(0, opInfos.size()));
+  if (context->isMultithreadingEnabled() &&
+      opInfos.size() > asyncExecutors.size()) {
+    SmallVector<size_t> costs;
+    costs.reserve(opInfos.size());
+    for (OpPMInfo &opInfo : opInfos) {
+      size_t cost = 0;
+      for (Region &region : opInfo.op->getRegions())
+        for (Block &block : region)
+          cost += block.getOperations().size();
+      costs.push_back(cost);
+    }
+    llvm::stable_sort(schedule, [&](unsigned lhs, unsigned rhs) {
+      return costs[lhs] > costs[rhs];
+    });
+  }
+
   // Signal a failure if any of the executors failed.
-  if (failed(failableParallelForEach(context, opInfos, processFn)))
+  if (failed(failableParallelForEach(context, opInfos.begin(), opInfos.end(),
+                                     schedule, processFn)))
     signalPassFailure();
 }
 
@@ -28,7 +28,18 @@ PatternApplicator::PatternApplicator(
     bytecode->initializeMutableState(*mutableByteCodeState);
   }
 }
-PatternApplicator::~PatternApplicator() = default;
+PatternApplicator::~PatternApplicator() {
+#if LLVM_ENABLE_ABI_BREAKING_CHECKS
+  LLVM_DEBUG({
+    for (const auto &[pattern, counts] : patternCounts) {
+      llvm::dbgs() << "Pattern '" << pattern->getDebugName() << "': "
+                   << counts.numAttempts << " attempted, "
+                   << counts.numSuccesses << " succeeded, "
+                   << counts.numFiltered << " skipped by the filter\n";
+    }
+  });
+#endif
+}
 
 #ifndef NDEBUG
 /// Log a message for a pattern that is impossible to match.
@@ -179,8 +190,15 @@ LogicalResult PatternApplicator::matchAndRewrite(
     ++(*bestPatternIt);
 
     // Check that the pattern can be applied.
-    if (canApply && !canApply(*bestPattern))
+    if (canApply && !canApply(*bestPattern)) {
+#if LLVM_ENABLE_ABI_BREAKING_CHECKS
+      ++patternCounts[bestPattern].numFiltered;
+#endif
       continue;
+    }
+#if LLVM_ENABLE_ABI_BREAKING_CHECKS
+    ++patternCounts[bestPattern].numAttempts;
+#endif
 
     // Try to match and rewrite this pattern. The patterns are sorted by
     // benefit, so if we match we can immediately rewrite. For PDL patterns, the
@@ -214,6 +232,9 @@ LogicalResult PatternApplicator::matchAndRewrite(
           if (succeeded(result) && onSuccess && failed(onSuccess(*bestPattern)))
             result = failure();
           if (succeeded(result)) {
+#if LLVM_ENABLE_ABI_BREAKING_CHECKS
+            ++patternCounts[bestPattern].numSuccesses;
+#endif
             LLVM_DEBUG(logSucessfulPatternApplication(dumpRootOp));
             matched = true;
             return;
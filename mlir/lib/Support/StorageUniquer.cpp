@@ -11,7 +11,9 @@
 #include "mlir/Support/LLVM.h"
 #include "mlir/Support/ThreadLocalCache.h"
 #include "mlir/Support/TypeID.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/RWMutex.h"
+#include "llvm/Support/Threading.h"
 
 using namespace mlir;
 using namespace mlir::detail;
@@ -352,8 +354,24 @@ struct StorageUniquerImpl {
   /// singleton.
   DenseMap<TypeID, BaseStorage *> singletonInstances;
 
+  /// The number of shards to use for each parametric uniquer. This scales with
+  /// the number of hardware threads so that heavily parallel workloads don't
+  /// all contend on the same few shard locks. Shards are allocated lazily, so
+  /// unused shards only cost a pointer.
+  size_t numParametricShards = getDefaultNumParametricShards();
+
   /// Flag specifying if multi-threading is enabled within the uniquer.
   bool threadingIsEnabled = true;
+
+private:
+  static size_t getDefaultNumParametricShards() {
+#if LLVM_ENABLE_THREADS != 0
+    unsigned numThreads = llvm::hardware_concurrency().compute_thread_count();
+    return std::clamp<size_t>(llvm::PowerOf2Ceil(numThreads * 2), 8, 128);
+#else
+    return 0;
+#endif
+  }
 };
 } // namespace detail
 } // namespace mlir
@@ -380,7 +398,8 @@ auto StorageUniquer::getParametricStorageTypeImpl(
 void StorageUniquer::registerParametricStorageTypeImpl(
     TypeID id, function_ref<void(BaseStorage *)> destructorFn) {
   impl->parametricUniquers.try_emplace(
-      id, std::make_unique<ParametricStorageUniquer>(destructorFn));
+      id, std::make_unique<ParametricStorageUniquer>(
+              destructorFn, impl->numParametricShards));
 }
 
 /// Implementation for getting an instance of a derived type with default